@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/chunk_resolver.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/record_batch.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <typename T>
+int64_t GetLength(const T& chunk) {
+  return chunk.length();
+}
+
+template <>
+int64_t GetLength<RecordBatch>(const RecordBatch& batch) {
+  return batch.num_rows();
+}
+
+template <typename T>
+std::vector<int64_t> MakeChunksOffsets(const std::vector<T>& chunks) {
+  std::vector<int64_t> offsets(chunks.size() + 1);
+  int64_t offset = 0;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    offsets[i] = offset;
+    offset += GetLength(*chunks[i]);
+  }
+  offsets[chunks.size()] = offset;
+  return offsets;
+}
+
+}  // namespace
+
+ChunkResolver::ChunkResolver(const ArrayVector& chunks)
+    : offsets_(MakeChunksOffsets(chunks)), cached_chunk_(0) {}
+
+ChunkResolver::ChunkResolver(const std::vector<const Array*>& chunks)
+    : offsets_(MakeChunksOffsets(chunks)), cached_chunk_(0) {}
+
+ChunkResolver::ChunkResolver(const RecordBatchVector& batches)
+    : offsets_(MakeChunksOffsets(batches)), cached_chunk_(0) {}
+
+ChunkResolver::ChunkResolver(ChunkResolver&& other) noexcept
+    : offsets_(std::move(other.offsets_)),
+      cached_chunk_(other.cached_chunk_.load(std::memory_order_relaxed)) {}
+
+ChunkResolver& ChunkResolver::operator=(ChunkResolver&& other) noexcept {
+  offsets_ = std::move(other.offsets_);
+  cached_chunk_.store(other.cached_chunk_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  return *this;
+}
+
+ChunkResolver::ChunkResolver(const ChunkResolver& other)
+    : offsets_(other.offsets_),
+      cached_chunk_(other.cached_chunk_.load(std::memory_order_relaxed)) {}
+
+ChunkResolver& ChunkResolver::operator=(const ChunkResolver& other) {
+  offsets_ = other.offsets_;
+  cached_chunk_.store(other.cached_chunk_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  return *this;
+}
+
+}  // namespace internal
+}  // namespace arrow
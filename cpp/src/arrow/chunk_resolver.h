@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The location of a logical element in a chunked sequence
+struct ChunkLocation {
+  /// \brief Index of the chunk holding the element
+  ///
+  /// This is the number of chunks if the logical index is past the end.
+  int64_t chunk_index;
+
+  /// \brief Index of the element within its chunk
+  int64_t index_in_chunk;
+};
+
+/// \brief EXPERIMENTAL: Map logical indices of a chunked sequence (such as a
+/// ChunkedArray or a vector of record batches) to chunk locations
+///
+/// Lookups first check the chunk hit by the previous lookup, which makes them
+/// O(1) for the common access patterns with some locality, and otherwise
+/// bisect the chunk offsets.  The cached chunk is only a hint, so a resolver
+/// can be shared between threads.
+class ARROW_EXPORT ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayVector& chunks);
+  explicit ChunkResolver(const std::vector<const Array*>& chunks);
+  explicit ChunkResolver(const RecordBatchVector& batches);
+
+  ChunkResolver(ChunkResolver&& other) noexcept;
+  ChunkResolver& operator=(ChunkResolver&& other) noexcept;
+  ChunkResolver(const ChunkResolver& other);
+  ChunkResolver& operator=(const ChunkResolver& other);
+
+  /// \brief Return the number of chunks
+  int64_t num_chunks() const { return static_cast<int64_t>(offsets_.size()) - 1; }
+
+  /// \brief Return the total length of all chunks
+  int64_t logical_length() const { return offsets_.back(); }
+
+  /// \brief Return the logical index of the first element of a chunk
+  ///
+  /// Passing num_chunks() returns logical_length().
+  int64_t chunk_offset(int64_t chunk_index) const { return offsets_[chunk_index]; }
+
+  /// \brief Resolve a logical index to a chunk location
+  ///
+  /// The index must not be negative.  Indices past the end resolve to
+  /// a chunk_index equal to num_chunks().
+  ChunkLocation Resolve(int64_t index) const {
+    const int64_t cached_chunk = cached_chunk_.load(std::memory_order_relaxed);
+    const int64_t chunk_index = ResolveChunkIndex(index, cached_chunk);
+    if (chunk_index != cached_chunk) {
+      cached_chunk_.store(chunk_index, std::memory_order_relaxed);
+    }
+    return MakeLocation(index, chunk_index);
+  }
+
+  /// \brief Resolve many logical indices at once
+  ///
+  /// This is equivalent to calling Resolve() on each index, but keeps the
+  /// chunk hint in a register and only updates the shared cache at the end.
+  ///
+  /// \param[in] num_indices the number of indices to resolve
+  /// \param[in] logical_indices the indices to resolve
+  /// \param[out] out_locations the resolved locations, num_indices of them
+  template <typename IndexType>
+  void ResolveMany(int64_t num_indices, const IndexType* logical_indices,
+                   ChunkLocation* out_locations) const {
+    const int64_t cached_chunk = cached_chunk_.load(std::memory_order_relaxed);
+    int64_t chunk_hint = cached_chunk;
+    for (int64_t i = 0; i < num_indices; ++i) {
+      const auto index = static_cast<int64_t>(logical_indices[i]);
+      chunk_hint = ResolveChunkIndex(index, chunk_hint);
+      out_locations[i] = MakeLocation(index, chunk_hint);
+    }
+    if (chunk_hint != cached_chunk) {
+      cached_chunk_.store(chunk_hint, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  int64_t ResolveChunkIndex(int64_t index, int64_t chunk_hint) const {
+    // It is common for algorithms to make consecutive accesses at a relatively
+    // small distance from each other, hence often falling in the same chunk.
+    // This is trivial when merging (assuming each side of the merge uses its
+    // own resolver), but also in the inner recursive invocations of partitioning
+    // or when taking sorted indices.
+    const int64_t num_offsets = static_cast<int64_t>(offsets_.size());
+    const int64_t* offsets = offsets_.data();
+    if (ARROW_PREDICT_TRUE(index >= offsets[chunk_hint]) &&
+        (chunk_hint + 1 == num_offsets || index < offsets[chunk_hint + 1])) {
+      return chunk_hint;
+    }
+    return Bisect(index, offsets, num_offsets);
+  }
+
+  // Find the last offset that is <= index, knowing that offsets[0] == 0.
+  // Like std::upper_bound(), but hand-written as it can help the compiler.
+  static int64_t Bisect(int64_t index, const int64_t* offsets, int64_t num_offsets) {
+    // Search [lo, lo + n)
+    int64_t lo = 0, n = num_offsets;
+    while (n > 1) {
+      const int64_t m = n >> 1;
+      const int64_t mid = lo + m;
+      if (index >= offsets[mid]) {
+        lo = mid;
+        n -= m;
+      } else {
+        n = m;
+      }
+    }
+    return lo;
+  }
+
+  ChunkLocation MakeLocation(int64_t index, int64_t chunk_index) const {
+    return {chunk_index, index - offsets_[chunk_index]};
+  }
+
+  // The logical index of the first element of each chunk, followed by the
+  // total length (so there are num_chunks() + 1 entries)
+  std::vector<int64_t> offsets_;
+
+  // The chunk hit by the last lookup
+  mutable std::atomic<int64_t> cached_chunk_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -43,7 +43,7 @@ class MemoryPool;
 // ChunkedArray methods
 
 ChunkedArray::ChunkedArray(ArrayVector chunks, std::shared_ptr<DataType> type)
-    : chunks_(std::move(chunks)), type_(std::move(type)) {
+    : chunks_(std::move(chunks)), type_(std::move(type)), chunk_resolver_(chunks_) {
   length_ = 0;
   null_count_ = 0;
 
@@ -147,13 +147,11 @@ bool ChunkedArray::ApproxEquals(const ChunkedArray& other,
 }
 
 Result<std::shared_ptr<Scalar>> ChunkedArray::GetScalar(int64_t index) const {
-  for (const auto& chunk : chunks_) {
-    if (index < chunk->length()) {
-      return chunk->GetScalar(index);
-    }
-    index -= chunk->length();
+  if (index < 0 || index >= length_) {
+    return Status::Invalid("index out of bounds");
   }
-  return Status::Invalid("index out of bounds");
+  const auto loc = chunk_resolver_.Resolve(index);
+  return chunks_[loc.chunk_index]->GetScalar(loc.index_in_chunk);
 }
 
 std::shared_ptr<ChunkedArray> ChunkedArray::Slice(int64_t offset, int64_t length) const {
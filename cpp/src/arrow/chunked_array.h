@@ -23,6 +23,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/chunk_resolver.h"
 #include "arrow/compare.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -141,8 +142,16 @@ class ARROW_EXPORT ChunkedArray {
   const std::shared_ptr<DataType>& type() const { return type_; }
 
   /// \brief Return a Scalar containing the value of this array at index
+  ///
+  /// The chunk holding the value is found with chunk_resolver(), so this is
+  /// O(1) when accessing nearby indices and O(log(num_chunks)) otherwise.
   Result<std::shared_ptr<Scalar>> GetScalar(int64_t index) const;
 
+  /// \brief Return the resolver mapping logical indices to chunk locations
+  ///
+  /// The resolver is built on construction and may be shared among threads.
+  const internal::ChunkResolver& chunk_resolver() const { return chunk_resolver_; }
+
   /// \brief Determine if two chunked arrays are equal.
   ///
   /// Two chunked arrays can be equal only if they have equal datatypes.
@@ -182,6 +191,8 @@ class ARROW_EXPORT ChunkedArray {
   std::shared_ptr<DataType> type_;
 
  private:
+  internal::ChunkResolver chunk_resolver_;
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(ChunkedArray);
 };
 
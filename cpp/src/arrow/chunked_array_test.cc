@@ -23,6 +23,8 @@
 #include <memory>
 #include <vector>
 
+#include "arrow/chunk_resolver.h"
+#include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_common.h"
@@ -276,7 +278,103 @@ TEST_F(TestChunkedArray, GetScalar) {
   check_scalar(carr, 4, **MakeScalar(ty, 3));
   check_scalar(carr, 6, **MakeScalar(ty, 5));
 
+  // Out of order accesses
+  check_scalar(carr, 5, **MakeScalar(ty, 4));
+  check_scalar(carr, 1, **MakeScalar(ty, 7));
+  check_scalar(carr, 6, **MakeScalar(ty, 5));
+
   ASSERT_RAISES(Invalid, carr.GetScalar(7));
+  ASSERT_RAISES(Invalid, carr.GetScalar(-1));
+}
+
+// ----------------------------------------------------------------------
+// ChunkResolver tests
+
+using internal::ChunkLocation;
+using internal::ChunkResolver;
+
+void AssertLocation(const ChunkLocation& loc, int64_t chunk_index,
+                    int64_t index_in_chunk) {
+  ASSERT_EQ(loc.chunk_index, chunk_index);
+  ASSERT_EQ(loc.index_in_chunk, index_in_chunk);
+}
+
+TEST(TestChunkResolver, Resolve) {
+  auto ty = int8();
+  ArrayVector chunks{ArrayFromJSON(ty, "[]"), ArrayFromJSON(ty, "[1, 2]"),
+                     ArrayFromJSON(ty, "[]"), ArrayFromJSON(ty, "[]"),
+                     ArrayFromJSON(ty, "[3]"), ArrayFromJSON(ty, "[4, 5, 6]"),
+                     ArrayFromJSON(ty, "[]")};
+  ChunkResolver resolver(chunks);
+  ASSERT_EQ(resolver.num_chunks(), 7);
+  ASSERT_EQ(resolver.logical_length(), 6);
+  ASSERT_EQ(resolver.chunk_offset(4), 2);
+  ASSERT_EQ(resolver.chunk_offset(7), 6);
+
+  // Empty chunks are skipped, whatever the order of accesses
+  for (int64_t index : {0, 1, 2, 3, 4, 5, 5, 3, 0, 2, 4, 1}) {
+    const auto loc = resolver.Resolve(index);
+    ASSERT_LT(loc.index_in_chunk, chunks[loc.chunk_index]->length());
+    ASSERT_EQ(resolver.chunk_offset(loc.chunk_index) + loc.index_in_chunk, index);
+  }
+  AssertLocation(resolver.Resolve(0), 1, 0);
+  AssertLocation(resolver.Resolve(2), 4, 0);
+  AssertLocation(resolver.Resolve(5), 5, 2);
+
+  // Indices past the end resolve to the number of chunks
+  AssertLocation(resolver.Resolve(6), 7, 0);
+  AssertLocation(resolver.Resolve(10), 7, 4);
+  AssertLocation(resolver.Resolve(3), 5, 0);
+
+  // No chunks at all
+  ChunkResolver empty_resolver(ArrayVector{});
+  ASSERT_EQ(empty_resolver.num_chunks(), 0);
+  AssertLocation(empty_resolver.Resolve(0), 0, 0);
+}
+
+TEST(TestChunkResolver, ResolveMany) {
+  auto ty = int8();
+  ArrayVector chunks;
+  for (int i = 0; i < 50; ++i) {
+    // Chunks of length 0 to 4
+    chunks.push_back(ArrayFromJSON(ty, "[1, 2, 3, 4]")->Slice(0, i % 5));
+  }
+  ChunkResolver resolver(chunks);
+  ChunkResolver expected_resolver(resolver);
+  const int64_t length = resolver.logical_length();
+
+  std::vector<uint16_t> indices;
+  for (int64_t i = 0; i < length; ++i) {
+    indices.push_back(static_cast<uint16_t>(i));
+  }
+  for (int64_t i = length - 1; i >= 0; i -= 3) {
+    indices.push_back(static_cast<uint16_t>(i));
+  }
+  for (int64_t i = 0; i < length; i += 7) {
+    indices.push_back(static_cast<uint16_t>((i * 31) % length));
+  }
+
+  std::vector<ChunkLocation> locations(indices.size());
+  resolver.ResolveMany(static_cast<int64_t>(indices.size()), indices.data(),
+                       locations.data());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    ARROW_SCOPED_TRACE("index = ", indices[i]);
+    const auto expected = expected_resolver.Resolve(indices[i]);
+    AssertLocation(locations[i], expected.chunk_index, expected.index_in_chunk);
+  }
+}
+
+TEST(TestChunkResolver, RecordBatches) {
+  auto schema = ::arrow::schema({field("a", int8())});
+  RecordBatchVector batches{
+      RecordBatchFromJSON(schema, R"([{"a": 1}, {"a": 2}])"),
+      RecordBatchFromJSON(schema, "[]"),
+      RecordBatchFromJSON(schema, R"([{"a": 3}])")};
+  ChunkResolver resolver(batches);
+  ASSERT_EQ(resolver.num_chunks(), 3);
+  ASSERT_EQ(resolver.logical_length(), 3);
+  AssertLocation(resolver.Resolve(1), 0, 1);
+  AssertLocation(resolver.Resolve(2), 2, 0);
 }
 
 }  // namespace arrow
@@ -141,6 +141,22 @@ class ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   bool ignore_case;
 };
 
+class ARROW_EXPORT MatchSubstringSetOptions : public FunctionOptions {
+ public:
+  explicit MatchSubstringSetOptions(std::vector<std::string> patterns,
+                                    std::vector<std::string> regex_patterns = {},
+                                    bool ignore_case = false);
+  MatchSubstringSetOptions();
+  constexpr static char const kTypeName[] = "MatchSubstringSetOptions";
+
+  /// Exact substrings to look for; pattern ids are their positions in this list.
+  std::vector<std::string> patterns;
+  /// Regular expressions to look for; pattern ids follow those of `patterns`.
+  std::vector<std::string> regex_patterns;
+  /// Whether to perform a case-insensitive match.
+  bool ignore_case;
+};
+
 class ARROW_EXPORT SplitOptions : public FunctionOptions {
  public:
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false);
@@ -780,6 +780,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
         (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
          kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL &&
          output_descr_.type->id() != Type::NA);
+    data_preallocated_.clear();
     if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
       ComputeDataPreallocate(*output_descr_.type, &data_preallocated_);
     }
@@ -836,6 +837,7 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
  public:
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
+    results_.clear();
     ExecBatch batch;
     if (kernel_->can_execute_chunkwise) {
       while (batch_iterator_->Next(&batch)) {
@@ -916,6 +918,7 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     validity_preallocated_ =
         (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
          kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL);
+    data_preallocated_.clear();
     if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
       ComputeDataPreallocate(*output_descr_.type, &data_preallocated_);
     }
@@ -1070,5 +1073,17 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
   return CallFunction(func_name, args, /*options=*/nullptr, ctx);
 }
 
+Result<std::shared_ptr<FunctionExecutor>> GetFunctionExecutor(
+    const std::string& func_name, std::vector<ValueDescr> in_descrs,
+    const FunctionOptions* options, ExecContext* ctx) {
+  FunctionRegistry* func_registry =
+      ctx == nullptr ? GetFunctionRegistry() : ctx->func_registry();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        func_registry->GetFunction(func_name));
+  ARROW_ASSIGN_OR_RAISE(auto executor, func->GetBestExecutor(std::move(in_descrs)));
+  RETURN_NOT_OK(executor->Init(options, ctx));
+  return executor;
+}
+
 }  // namespace compute
 }  // namespace arrow
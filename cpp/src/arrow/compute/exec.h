@@ -34,6 +34,7 @@
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -199,6 +200,14 @@ struct ARROW_EXPORT ExecBatch {
   /// A predicate Expression guaranteed to evaluate to true for all rows in this batch.
   Expression guarantee = literal(true);
 
+  /// The position of this batch in the sequence emitted by its source, if known.
+  ///
+  /// Source nodes number batches in the order they are produced and nodes which map
+  /// each input batch to a single output batch (filter, project) preserve the index.
+  /// Sinks can use it to restore the source order after batches were processed in
+  /// parallel. Nodes which combine or split batches leave it unset.
+  util::optional<int64_t> index;
+
   /// The semantic length of the ExecBatch. When the values are all scalars,
   /// the length should be set to 1 for non-aggregate kernels, otherwise the
   /// length is taken from the array values, except when there is a selection
@@ -271,6 +280,19 @@ ARROW_EXPORT
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            ExecContext* ctx = NULLPTR);
 
+/// \brief Bind a function to a kernel for repeated calls on the given
+/// argument types.
+///
+/// Looks up the function, dispatches the best-match kernel and initializes its
+/// state once.  The returned executor's Execute() can then be invoked
+/// repeatedly on new arguments of the same types and shapes, which avoids the
+/// per-call overhead of CallFunction on small batches.  `options` and `ctx`
+/// must remain valid for the lifetime of the executor.
+ARROW_EXPORT
+Result<std::shared_ptr<FunctionExecutor>> GetFunctionExecutor(
+    const std::string& func_name, std::vector<ValueDescr> in_descrs,
+    const FunctionOptions* options = NULLPTR, ExecContext* ctx = NULLPTR);
+
 /// @}
 
 }  // namespace compute
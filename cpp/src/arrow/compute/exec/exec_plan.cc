@@ -360,11 +360,13 @@ void MapNode::SubmitTask(std::function<Result<ExecBatch>(ExecBatch)> map_fn,
   }
   auto task = [this, map_fn, batch]() {
     auto guarantee = batch.guarantee;
+    auto index = batch.index;
     auto output_batch = map_fn(std::move(batch));
     if (ErrorIfNotOk(output_batch.status())) {
       return output_batch.status();
     }
     output_batch->guarantee = guarantee;
+    output_batch->index = index;
     outputs_[0]->InputReceived(this, output_batch.MoveValueUnsafe());
     return Status::OK();
   };
@@ -22,8 +22,10 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec/hash_join_dict.h"
 #include "arrow/compute/exec/task_util.h"
 #include "arrow/compute/kernels/row_encoder.h"
@@ -92,6 +94,11 @@ class HashJoinBasicImpl : public HashJoinImpl {
     schema_mgr_ = schema_mgr;
     key_cmp_ = std::move(key_cmp);
     filter_ = std::move(filter);
+    // Without a residual filter, left semi and anti joins only need to know whether a
+    // key is present on the build side
+    key_set_only_ = (join_type_ == JoinType::LEFT_SEMI ||
+                     join_type_ == JoinType::LEFT_ANTI) &&
+                    filter_ == literal(true);
     output_batch_callback_ = std::move(output_batch_callback);
     finished_callback_ = std::move(finished_callback);
     local_states_.resize(num_threads);
@@ -144,6 +151,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
     if (!local_state.is_initialized) {
       InitEncoder(0, HashJoinProjection::KEY, &local_state.exec_batch_keys);
       bool has_payload =
+          !key_set_only_ &&
           (schema_mgr_->proj_maps[0].num_cols(HashJoinProjection::PAYLOAD) > 0);
       if (has_payload) {
         InitEncoder(0, HashJoinProjection::PAYLOAD, &local_state.exec_batch_payloads);
@@ -219,6 +227,76 @@ class HashJoinBasicImpl : public HashJoinImpl {
     }
   }
 
+  // Lookup used when the build side is only a set of distinct keys. Sorts probe rows
+  // into match and no_match without enumerating matching build side rows.
+  void ProbeBatch_LookupKeySet(const RowEncoder& exec_batch_keys,
+                               const std::vector<const uint8_t*>& non_null_bit_vectors,
+                               const std::vector<int64_t>& non_null_bit_vector_offsets,
+                               std::vector<int32_t>* output_match,
+                               std::vector<int32_t>* output_no_match) {
+    ARROW_DCHECK(has_hash_table_);
+
+    int num_cols = static_cast<int>(non_null_bit_vectors.size());
+    for (int32_t irow = 0; irow < exec_batch_keys.num_rows(); ++irow) {
+      // Apply null key filtering
+      bool no_match = hash_table_empty_;
+      for (int icol = 0; icol < num_cols; ++icol) {
+        bool is_null = non_null_bit_vectors[icol] &&
+                       !bit_util::GetBit(non_null_bit_vectors[icol],
+                                         non_null_bit_vector_offsets[icol] + irow);
+        if (key_cmp_[icol] == JoinKeyCmp::EQ && is_null) {
+          no_match = true;
+          break;
+        }
+      }
+      if (!no_match && key_set_.count(exec_batch_keys.encoded_row(irow)) > 0) {
+        output_match->push_back(irow);
+      } else {
+        output_no_match->push_back(irow);
+      }
+    }
+  }
+
+  // Output selected rows of a probe side batch. Output columns are taken directly from
+  // the input batch instead of being decoded from the row encoders.
+  Status ProbeBatch_OutputFiltered(const ExecBatch& batch,
+                                   const std::vector<int32_t>& ids) {
+    int num_out_cols = schema_mgr_->proj_maps[0].num_cols(HashJoinProjection::OUTPUT);
+    auto to_input = schema_mgr_->proj_maps[0].map(HashJoinProjection::OUTPUT,
+                                                  HashJoinProjection::INPUT);
+
+    for (size_t start = 0; start < ids.size(); start += output_batch_size_) {
+      int64_t batch_size_next = std::min(static_cast<int64_t>(ids.size() - start),
+                                         static_cast<int64_t>(output_batch_size_));
+      ExecBatch result({}, batch_size_next);
+      result.values.resize(num_out_cols);
+
+      if (batch_size_next == batch.length) {
+        // Every row of the batch is selected
+        for (int icol = 0; icol < num_out_cols; ++icol) {
+          result.values[icol] = batch.values[to_input.get(icol)];
+        }
+      } else {
+        auto indices = std::make_shared<Int32Array>(
+            batch_size_next, Buffer::Wrap(ids.data() + start, batch_size_next));
+        for (int icol = 0; icol < num_out_cols; ++icol) {
+          const Datum& value = batch.values[to_input.get(icol)];
+          if (value.is_scalar()) {
+            result.values[icol] = value;
+          } else {
+            ARROW_ASSIGN_OR_RAISE(
+                result.values[icol],
+                Take(value, indices, TakeOptions::NoBoundsCheck(), ctx_));
+          }
+        }
+      }
+
+      output_batch_callback_(std::move(result));
+      num_batches_produced_++;
+    }
+    return Status::OK();
+  }
+
   void ProbeBatch_OutputOne(int64_t batch_size_next, ExecBatch* opt_left_key,
                             ExecBatch* opt_left_payload, ExecBatch* opt_right_key,
                             ExecBatch* opt_right_payload) {
@@ -539,6 +617,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
     RETURN_NOT_OK(EncodeBatch(0, HashJoinProjection::KEY, &local_state.exec_batch_keys,
                               batch, &batch_key_for_lookups));
     bool has_left_payload =
+        !key_set_only_ &&
         (schema_mgr_->proj_maps[0].num_cols(HashJoinProjection::PAYLOAD) > 0);
     if (has_left_payload) {
       local_state.exec_batch_payloads.Clear();
@@ -568,6 +647,15 @@ class HashJoinBasicImpl : public HashJoinImpl {
     NullInfoFromBatch(batch_key_for_lookups, &non_null_bit_vectors,
                       &non_null_bit_vector_offsets, &all_nulls);
 
+    if (key_set_only_) {
+      ProbeBatch_LookupKeySet(*row_encoder_for_lookups, non_null_bit_vectors,
+                              non_null_bit_vector_offsets, &local_state.match,
+                              &local_state.no_match);
+      return ProbeBatch_OutputFiltered(
+          batch, join_type_ == JoinType::LEFT_SEMI ? local_state.match
+                                                   : local_state.no_match);
+    }
+
     ProbeBatch_Lookup(&local_state, *row_encoder_for_lookups, non_null_bit_vectors,
                       non_null_bit_vector_offsets, &local_state.match,
                       &local_state.no_match, &local_state.match_left,
@@ -599,6 +687,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
     } else {
       dict_build_.InitEncoder(schema_mgr_->proj_maps[1], &hash_table_keys_, ctx_);
       bool has_payload =
+          !key_set_only_ &&
           (schema_mgr_->proj_maps[1].num_cols(HashJoinProjection::PAYLOAD) > 0);
       if (has_payload) {
         InitEncoder(1, HashJoinProjection::PAYLOAD, &hash_table_payloads_);
@@ -624,6 +713,14 @@ class HashJoinBasicImpl : public HashJoinImpl {
               EncodeBatch(1, HashJoinProjection::PAYLOAD, &hash_table_payloads_, batch));
         }
         int32_t num_rows_after = hash_table_keys_.num_rows();
+        if (key_set_only_) {
+          // Only distinct keys are kept, encoded rows are discarded after each batch
+          for (int32_t irow = num_rows_before; irow < num_rows_after; ++irow) {
+            key_set_.insert(hash_table_keys_.encoded_row(irow));
+          }
+          hash_table_keys_.Clear();
+          continue;
+        }
         for (int32_t irow = num_rows_before; irow < num_rows_after; ++irow) {
           hash_table_.insert(std::make_pair(hash_table_keys_.encoded_row(irow), irow));
         }
@@ -828,7 +925,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
   }
 
   void MergeHasMatch() {
-    if (hash_table_empty_) {
+    if (hash_table_empty_ || key_set_only_) {
       return;
     }
 
@@ -859,6 +956,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
   HashJoinSchema* schema_mgr_;
   std::vector<JoinKeyCmp> key_cmp_;
   Expression filter_;
+  bool key_set_only_;
   std::unique_ptr<TaskScheduler> scheduler_;
   int task_group_build_;
   int task_group_queued_;
@@ -889,6 +987,8 @@ class HashJoinBasicImpl : public HashJoinImpl {
   RowEncoder hash_table_keys_;
   RowEncoder hash_table_payloads_;
   std::unordered_multimap<std::string, int32_t> hash_table_;
+  // Distinct build side keys, used instead of hash_table_ when key_set_only_
+  std::unordered_set<std::string> key_set_;
   std::vector<uint8_t> has_match_;
   bool hash_table_empty_;
 
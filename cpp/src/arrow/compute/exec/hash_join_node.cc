@@ -15,8 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <mutex>
 #include <unordered_set>
 
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/hash_join.h"
 #include "arrow/compute/exec/hash_join_dict.h"
@@ -436,7 +442,10 @@ class HashJoinNode : public ExecNode {
         key_cmp_(join_options.key_cmp),
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
-        impl_(std::move(impl)) {
+        impl_(std::move(impl)),
+        left_keys_(join_options.left_keys),
+        dynamic_filter_(join_options.dynamic_filter),
+        dynamic_filter_max_keys_(join_options.dynamic_filter_max_keys) {
     complete_.store(false);
   }
 
@@ -470,6 +479,15 @@ class HashJoinNode : public ExecNode {
         Expression filter,
         schema_mgr->BindFilter(join_options.filter, left_schema, right_schema));
 
+    if (join_options.dynamic_filter.is_valid() &&
+        (join_options.join_type == JoinType::LEFT_OUTER ||
+         join_options.join_type == JoinType::LEFT_ANTI ||
+         join_options.join_type == JoinType::FULL_OUTER)) {
+      return Status::Invalid(
+          "A dynamic filter cannot be used with a join type which outputs unmatched "
+          "left rows");
+    }
+
     // Generate output schema
     std::shared_ptr<Schema> output_schema = schema_mgr->MakeOutputSchema(
         join_options.output_prefix_for_left, join_options.output_prefix_for_right);
@@ -493,6 +511,9 @@ class HashJoinNode : public ExecNode {
 
     size_t thread_index = thread_indexer_();
     int side = (input == inputs_[0]) ? 0 : 1;
+    if (side == 1 && dynamic_filter_.is_valid()) {
+      CollectBuildKeys(batch);
+    }
     {
       Status status = impl_->InputReceived(thread_index, side, std::move(batch));
       if (!status.ok()) {
@@ -502,6 +523,9 @@ class HashJoinNode : public ExecNode {
       }
     }
     if (batch_count_[side].Increment()) {
+      if (side == 1) {
+        PublishDynamicFilter();
+      }
       Status status = impl_->InputFinished(thread_index, side);
       if (!status.ok()) {
         StopProducing();
@@ -524,6 +548,9 @@ class HashJoinNode : public ExecNode {
     int side = (input == inputs_[0]) ? 0 : 1;
 
     if (batch_count_[side].SetTotal(total_batches)) {
+      if (side == 1) {
+        PublishDynamicFilter();
+      }
       Status status = impl_->InputFinished(thread_index, side);
       if (!status.ok()) {
         StopProducing();
@@ -562,6 +589,8 @@ class HashJoinNode : public ExecNode {
   void StopProducing() override {
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
+      // Release a scan waiting for the dynamic filter so that it can be stopped
+      MarkDynamicFilterFinished(literal(true));
       for (auto&& input : inputs_) {
         input->StopProducing(this);
       }
@@ -572,6 +601,103 @@ class HashJoinNode : public ExecNode {
   Future<> finished() override { return finished_; }
 
  private:
+  void CollectBuildKeys(const ExecBatch& batch) {
+    int num_keys = schema_mgr_->proj_maps[1].num_cols(HashJoinProjection::KEY);
+    auto to_input =
+        schema_mgr_->proj_maps[1].map(HashJoinProjection::KEY, HashJoinProjection::INPUT);
+    ExecBatch keys({}, batch.length);
+    keys.values.resize(num_keys);
+    for (int icol = 0; icol < num_keys; ++icol) {
+      keys.values[icol] = batch.values[to_input.get(icol)];
+    }
+    std::lock_guard<std::mutex> lock(build_keys_mutex_);
+    build_keys_.push_back(std::move(keys));
+  }
+
+  // Summarize the right keys as a predicate on the left keys. For each key compared
+  // with EQ the predicate lists the distinct values (if there are few enough of them,
+  // for pruning by partition expressions) and their range (for pruning by statistics).
+  Result<Expression> MakeDynamicFilter() {
+    std::lock_guard<std::mutex> lock(build_keys_mutex_);
+    ExecContext* ctx = plan_->exec_context();
+    const auto& left_schema = *inputs_[0]->output_schema();
+
+    std::vector<Expression> conjuncts;
+    for (size_t icol = 0; icol < left_keys_.size(); ++icol) {
+      if (key_cmp_[icol] != JoinKeyCmp::EQ) {
+        continue;
+      }
+      const auto& type = schema_mgr_->proj_maps[1].data_type(HashJoinProjection::KEY,
+                                                             static_cast<int>(icol));
+      ARROW_ASSIGN_OR_RAISE(auto left_field, left_keys_[icol].GetOne(left_schema));
+      if (type->id() == Type::DICTIONARY || !left_field->type()->Equals(*type)) {
+        continue;
+      }
+
+      ArrayVector chunks;
+      for (const ExecBatch& keys : build_keys_) {
+        if (keys.values[icol].is_array()) {
+          chunks.push_back(keys.values[icol].make_array());
+        } else {
+          ARROW_ASSIGN_OR_RAISE(auto chunk,
+                                MakeArrayFromScalar(*keys.values[icol].scalar(),
+                                                    keys.length, ctx->memory_pool()));
+          chunks.push_back(std::move(chunk));
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto unique,
+                            Unique(std::make_shared<ChunkedArray>(chunks, type), ctx));
+      ARROW_ASSIGN_OR_RAISE(auto distinct, DropNull(*unique, ctx));
+      if (distinct->length() == 0) {
+        // Null keys never compare equal, so no left row can have a match
+        return literal(false);
+      }
+
+      if (distinct->length() <= dynamic_filter_max_keys_) {
+        conjuncts.push_back(call("is_in", {field_ref(left_keys_[icol])},
+                                 SetLookupOptions{distinct}));
+      }
+      auto maybe_min_max = MinMax(distinct, ScalarAggregateOptions::Defaults(), ctx);
+      if (maybe_min_max.ok()) {
+        const auto& min_max = maybe_min_max->scalar_as<StructScalar>();
+        conjuncts.push_back(
+            greater_equal(field_ref(left_keys_[icol]), literal(min_max.value[0])));
+        conjuncts.push_back(
+            less_equal(field_ref(left_keys_[icol]), literal(min_max.value[1])));
+      }
+    }
+    build_keys_.clear();
+    return and_(conjuncts);
+  }
+
+  void PublishDynamicFilter() {
+    if (!dynamic_filter_.is_valid()) {
+      return;
+    }
+    bool has_build_rows = false;
+    {
+      std::lock_guard<std::mutex> lock(build_keys_mutex_);
+      for (const ExecBatch& keys : build_keys_) {
+        has_build_rows = has_build_rows || keys.length > 0;
+      }
+    }
+    if (!has_build_rows) {
+      MarkDynamicFilterFinished(literal(false));
+      return;
+    }
+    MarkDynamicFilterFinished(MakeDynamicFilter());
+  }
+
+  void MarkDynamicFilterFinished(Result<Expression> filter) {
+    if (!dynamic_filter_.is_valid()) {
+      return;
+    }
+    bool expected = false;
+    if (dynamic_filter_published_.compare_exchange_strong(expected, true)) {
+      dynamic_filter_.MarkFinished(std::move(filter));
+    }
+  }
+
   void OutputBatchCallback(ExecBatch batch) {
     outputs_[0]->InputReceived(this, std::move(batch));
   }
@@ -613,6 +739,13 @@ class HashJoinNode : public ExecNode {
   ThreadIndexer thread_indexer_;
   std::unique_ptr<HashJoinSchema> schema_mgr_;
   std::unique_ptr<HashJoinImpl> impl_;
+
+  std::vector<FieldRef> left_keys_;
+  Future<Expression> dynamic_filter_;
+  int64_t dynamic_filter_max_keys_;
+  std::atomic<bool> dynamic_filter_published_{false};
+  std::mutex build_keys_mutex_;
+  std::vector<ExecBatch> build_keys_;
 };
 
 namespace internal {
@@ -243,6 +243,105 @@ TEST_P(HashJoinTest, TestSemiJoinsEmpty) {
   RunEmptyTest(std::get<0>(GetParam()), std::get<1>(GetParam()));
 }
 
+TEST(HashJoin, LeftSemiAntiDuplicateAndNullKeys) {
+  auto l_schema = schema({field("l_str", utf8()), field("l_i32", int32())});
+  auto r_schema = schema({field("r_i32", int32())});
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    int multiplicity = parallel ? 100 : 1;
+
+    auto l_batches = GenerateBatchesFromString(
+        l_schema, {R"([["a", 1], ["b", null], ["c", 2]])", R"([["d", 3], ["e", 1]])"},
+        multiplicity);
+    // Build side keys repeat within and across batches
+    auto r_batches = GenerateBatchesFromString(
+        r_schema, {R"([[1], [1], [null]])", R"([[1], [2], [5]])"}, multiplicity);
+
+    auto exp_semi = GenerateBatchesFromString(
+        l_schema, {R"([["a", 1], ["c", 2]])", R"([["e", 1]])"}, multiplicity);
+    CheckRunOutput(JoinType::LEFT_SEMI, l_batches, r_batches,
+                   /*left_keys=*/{{"l_i32"}}, /*right_keys=*/{{"r_i32"}}, exp_semi,
+                   parallel);
+
+    auto exp_anti = GenerateBatchesFromString(
+        l_schema, {R"([["b", null]])", R"([["d", 3]])"}, multiplicity);
+    CheckRunOutput(JoinType::LEFT_ANTI, l_batches, r_batches,
+                   /*left_keys=*/{{"l_i32"}}, /*right_keys=*/{{"r_i32"}}, exp_anti,
+                   parallel);
+  }
+}
+
+TEST(HashJoin, DynamicFilter) {
+  auto l_schema = schema({field("l_str", utf8()), field("l_i32", int32())});
+  auto r_schema = schema({field("r_i32", int32())});
+
+  auto l_batches =
+      GenerateBatchesFromString(l_schema, {R"([["a", 1], ["b", 3], ["c", 5]])"});
+
+  auto RunJoin = [&](const HashJoinNodeOptions& join_options,
+                     const BatchesWithSchema& r_batches)
+      -> Result<std::vector<ExecBatch>> {
+    ARROW_ASSIGN_OR_RAISE(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+    Declaration join{"hashjoin", join_options};
+    join.inputs.emplace_back(Declaration{
+        "source", SourceNodeOptions{l_batches.schema, l_batches.gen(false, false)}});
+    join.inputs.emplace_back(Declaration{
+        "source", SourceNodeOptions{r_batches.schema, r_batches.gen(false, false)}});
+    RETURN_NOT_OK(Declaration::Sequence({join, {"sink", SinkNodeOptions{&sink_gen}}})
+                      .AddToPlan(plan.get()));
+    return StartAndCollect(plan.get(), sink_gen).result();
+  };
+
+  HashJoinNodeOptions join_options{JoinType::INNER, {"l_i32"}, {"r_i32"}};
+  join_options.dynamic_filter = Future<Expression>::Make();
+  join_options.dynamic_filter_max_keys = 3;
+  auto r_batches =
+      GenerateBatchesFromString(r_schema, {R"([[5], [1], [null]])", R"([[1], [2]])"});
+  ASSERT_OK(RunJoin(join_options, r_batches).status());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto dynamic_filter, join_options.dynamic_filter);
+  EXPECT_EQ(dynamic_filter,
+            and_({call("is_in", {field_ref("l_i32")},
+                       SetLookupOptions{ArrayFromJSON(int32(), "[5, 1, 2]")}),
+                  greater_equal(field_ref("l_i32"), literal(1)),
+                  less_equal(field_ref("l_i32"), literal(5))}));
+
+  // only the range is published for build sides with many distinct keys
+  join_options.join_type = JoinType::LEFT_SEMI;
+  join_options.dynamic_filter = Future<Expression>::Make();
+  join_options.dynamic_filter_max_keys = 1;
+  ASSERT_OK_AND_ASSIGN(
+      auto result,
+      RunJoin(join_options, GenerateBatchesFromString(r_schema, {R"([[3], [2]])"})));
+  AssertExecBatchesEqual(l_schema, result,
+                         {ExecBatchFromJSON({utf8(), int32()}, R"([["b", 3]])")});
+  ASSERT_FINISHES_OK_AND_ASSIGN(dynamic_filter, join_options.dynamic_filter);
+  EXPECT_EQ(dynamic_filter, and_(greater_equal(field_ref("l_i32"), literal(2)),
+                                 less_equal(field_ref("l_i32"), literal(3))));
+
+  // an empty build side can't match anything
+  join_options.dynamic_filter = Future<Expression>::Make();
+  ASSERT_OK(RunJoin(join_options, GenerateBatchesFromString(r_schema, {R"([])"}))
+                .status());
+  ASSERT_FINISHES_OK_AND_ASSIGN(dynamic_filter, join_options.dynamic_filter);
+  EXPECT_EQ(dynamic_filter, literal(false));
+
+  // the left rows of an anti join don't need a match, so they can't be pruned
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  join_options.join_type = JoinType::LEFT_ANTI;
+  ASSERT_OK_AND_ASSIGN(
+      auto left_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{l_batches.schema, l_batches.gen(false, false)}));
+  ASSERT_OK_AND_ASSIGN(
+      auto right_source,
+      MakeExecNode("source", plan.get(), {},
+                   SourceNodeOptions{l_batches.schema, l_batches.gen(false, false)}));
+  ASSERT_RAISES(Invalid, MakeExecNode("hashjoin", plan.get(),
+                                      {left_source, right_source}, join_options));
+}
+
 class Random64Bit {
  public:
   explicit Random64Bit(random::SeedType seed) : rng_(seed) {}
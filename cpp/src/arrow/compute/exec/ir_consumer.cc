@@ -22,6 +22,7 @@
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec/exec_plan.h"
 #include "arrow/compute/exec/expression.h"
+#include "arrow/compute/exec/expression_internal.h"
 #include "arrow/compute/exec/options.h"
 #include "arrow/compute/function_internal.h"
 #include "arrow/ipc/dictionary.h"
@@ -657,5 +658,193 @@ Result<Declaration> Convert(const ir::Relation& rel) {
   return Status::NotImplemented("RelationImpl::", EnumNameRelationImpl(rel.impl_type()));
 }
 
+namespace {
+
+// Replace positional references to parameters with references by name so that
+// parameters can be substituted without knowledge of each node's input schema.
+Result<Expression> NameParameters(Expression expr, int num_input_fields,
+                                  const Schema& parameters_schema) {
+  return Modify(
+      std::move(expr),
+      [&](Expression expr) -> Result<Expression> {
+        auto ref = expr.field_ref();
+        if (!ref || !ref->field_path()) return expr;
+
+        const auto& indices = ref->field_path()->indices();
+        int i = indices[0] - num_input_fields;
+        if (i < 0) return expr;
+
+        if (i >= parameters_schema.num_fields() || indices.size() != 1) {
+          return Status::Invalid("Field reference ", ref->ToString(),
+                                 " is out of range for an input with ",
+                                 num_input_fields, " fields and ",
+                                 parameters_schema.num_fields(), " parameters");
+        }
+        return field_ref(parameters_schema.field(i)->name());
+      },
+      [](Expression expr, ...) { return expr; });
+}
+
+Result<Expression> BindWithParameters(const Expression& expr, const Schema& input_schema,
+                                      const Schema& parameters_schema,
+                                      ExecContext* exec_context) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto named, NameParameters(expr, input_schema.num_fields(), parameters_schema));
+
+  FieldVector fields = input_schema.fields();
+  fields.insert(fields.end(), parameters_schema.fields().begin(),
+                parameters_schema.fields().end());
+  return named.Bind(Schema(std::move(fields)), exec_context);
+}
+
+// Returns the output schema of the prepared declaration, or null if it cannot be
+// inferred without building the node.
+Result<std::shared_ptr<Schema>> PrepareImpl(Declaration* declaration,
+                                            const Schema& parameters_schema,
+                                            ExecContext* exec_context) {
+  std::vector<std::shared_ptr<Schema>> input_schemas;
+  for (auto& input : declaration->inputs) {
+    if (auto node = util::get_if<ExecNode*>(&input)) {
+      input_schemas.push_back((*node)->output_schema());
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto input_schema,
+                          PrepareImpl(&util::get<Declaration>(input), parameters_schema,
+                                      exec_context));
+    input_schemas.push_back(std::move(input_schema));
+  }
+
+  const auto& name = declaration->factory_name;
+
+  if (name == "source") {
+    return checked_cast<const SourceNodeOptions&>(*declaration->options).output_schema;
+  }
+
+  if (name == "catalog_source") {
+    const auto& options =
+        checked_cast<const CatalogSourceNodeOptions&>(*declaration->options);
+    if (!options.projection.empty()) return nullptr;
+    return options.schema;
+  }
+
+  if (input_schemas.size() != 1 || input_schemas[0] == nullptr) return nullptr;
+  const auto& input_schema = *input_schemas[0];
+
+  if (name == "filter") {
+    auto options = checked_cast<const FilterNodeOptions&>(*declaration->options);
+    ARROW_ASSIGN_OR_RAISE(options.filter_expression,
+                          BindWithParameters(options.filter_expression, input_schema,
+                                             parameters_schema, exec_context));
+    declaration->options = std::make_shared<FilterNodeOptions>(std::move(options));
+    return input_schemas[0];
+  }
+
+  if (name == "project") {
+    auto options = checked_cast<const ProjectNodeOptions&>(*declaration->options);
+
+    // Fix names now since the bound and substituted expressions will not print
+    // as the user wrote them, and output names should not depend on parameter values.
+    if (options.names.empty()) {
+      for (const auto& expr : options.expressions) {
+        options.names.push_back(expr.ToString());
+      }
+    }
+
+    FieldVector fields(options.expressions.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+      auto& expr = options.expressions[i];
+      ARROW_ASSIGN_OR_RAISE(expr, BindWithParameters(expr, input_schema,
+                                                     parameters_schema, exec_context));
+      fields[i] = field(options.names[i], expr.type());
+    }
+    declaration->options = std::make_shared<ProjectNodeOptions>(std::move(options));
+    return schema(std::move(fields));
+  }
+
+  return nullptr;
+}
+
+Result<Expression> SubstituteParameters(Expression expr, const Schema& parameters_schema,
+                                        const std::vector<Datum>& parameters) {
+  // Parameters have exactly the types they were bound with, so the kernels
+  // resolved for each call remain valid after substitution.
+  return Modify(
+      std::move(expr),
+      [&](Expression expr) -> Result<Expression> {
+        auto ref = expr.field_ref();
+        if (!ref || !ref->name()) return expr;
+
+        int i = parameters_schema.GetFieldIndex(*ref->name());
+        if (i == -1) return expr;
+        return literal(parameters[i]);
+      },
+      [](Expression expr, ...) { return expr; });
+}
+
+Status InstantiateImpl(Declaration* declaration, const Schema& parameters_schema,
+                       const std::vector<Datum>& parameters) {
+  for (auto& input : declaration->inputs) {
+    if (auto input_declaration = util::get_if<Declaration>(&input)) {
+      RETURN_NOT_OK(InstantiateImpl(input_declaration, parameters_schema, parameters));
+    }
+  }
+
+  const auto& name = declaration->factory_name;
+
+  if (name == "filter") {
+    auto options = checked_cast<const FilterNodeOptions&>(*declaration->options);
+    ARROW_ASSIGN_OR_RAISE(options.filter_expression,
+                          SubstituteParameters(std::move(options.filter_expression),
+                                               parameters_schema, parameters));
+    declaration->options = std::make_shared<FilterNodeOptions>(std::move(options));
+  } else if (name == "project") {
+    auto options = checked_cast<const ProjectNodeOptions&>(*declaration->options);
+    for (auto& expr : options.expressions) {
+      ARROW_ASSIGN_OR_RAISE(
+          expr, SubstituteParameters(std::move(expr), parameters_schema, parameters));
+    }
+    declaration->options = std::make_shared<ProjectNodeOptions>(std::move(options));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace
+
+Result<PreparedDeclaration> Prepare(const Declaration& declaration,
+                                    std::shared_ptr<Schema> parameters_schema,
+                                    ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    ExecContext exec_context;
+    return Prepare(declaration, std::move(parameters_schema), &exec_context);
+  }
+
+  PreparedDeclaration prepared{declaration, std::move(parameters_schema)};
+  RETURN_NOT_OK(
+      PrepareImpl(&prepared.declaration, *prepared.parameters_schema, exec_context));
+  return prepared;
+}
+
+Result<Declaration> PreparedDeclaration::Instantiate(
+    const std::vector<Datum>& parameters) const {
+  if (static_cast<int>(parameters.size()) != parameters_schema->num_fields()) {
+    return Status::Invalid("Expected ", parameters_schema->num_fields(),
+                           " parameters but got ", parameters.size());
+  }
+
+  for (int i = 0; i < parameters_schema->num_fields(); ++i) {
+    const auto& expected = parameters_schema->field(i);
+    if (!parameters[i].is_scalar() || !parameters[i].type()->Equals(expected->type())) {
+      return Status::TypeError("Parameter ", expected->name(), " should be a scalar of type ",
+                               expected->type()->ToString(), " but got ",
+                               parameters[i].ToString());
+    }
+  }
+
+  Declaration out = declaration;
+  RETURN_NOT_OK(InstantiateImpl(&out, *parameters_schema, parameters));
+  return out;
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -66,5 +66,36 @@ auto ConvertRoot(const Buffer& buf) -> decltype(Convert(std::declval<Ir>())) {
   return Convert(*flatbuffers::GetRoot<Ir>(buf.data()));
 }
 
+/// \brief A Declaration whose expressions have been bound ahead of time.
+///
+/// Filter and project expressions are bound to their input schemas (resolving kernels
+/// and inserting implicit casts) when the PreparedDeclaration is created. Instantiating
+/// it only substitutes parameter values, so a prepared plan may be cached and reused
+/// for repeated execution of the same query with different parameters.
+///
+/// Parameters are referenced from expressions as fields which do not appear in the
+/// input schema: either by name or by position past the input's last field, so that
+/// the i-th parameter of a node with N input fields is FieldRef(N + i). This is the
+/// form in which positional references arrive from a converted ir::Relation.
+struct ARROW_EXPORT PreparedDeclaration {
+  /// \brief Produce a Declaration with parameter values substituted as literals.
+  ///
+  /// parameters must have the types of parameters_schema's fields.
+  Result<Declaration> Instantiate(const std::vector<Datum>& parameters) const;
+
+  Declaration declaration;
+  std::shared_ptr<Schema> parameters_schema;
+};
+
+/// \brief Bind the expressions of a Declaration whose input schemas can be inferred.
+///
+/// Nodes whose input schemas cannot be inferred before the plan is built (for example
+/// those downstream of an aggregation) are left unbound and will be bound when the
+/// Declaration is added to an ExecPlan. Such nodes may only reference parameters by name.
+ARROW_EXPORT
+Result<PreparedDeclaration> Prepare(const Declaration& declaration,
+                                    std::shared_ptr<Schema> parameters_schema,
+                                    ExecContext* exec_context = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
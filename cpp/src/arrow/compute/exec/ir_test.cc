@@ -836,5 +836,51 @@ TEST(Relation, ProjectionWithSort) {
       }))));
 }
 
+TEST(Prepare, FilterProjectWithParameters) {
+  auto input = MakeBasicBatches();
+  auto parameters_schema = schema({field("threshold", int32()), field("offset", int32())});
+
+  // each instantiation of the prepared plan reads the input anew
+  AsyncGenerator<util::optional<ExecBatch>> source_gen, sink_gen;
+  ASSERT_OK_AND_ASSIGN(
+      auto prepared,
+      Prepare(Declaration::Sequence({
+                  {"source",
+                   SourceNodeOptions{input.schema, [&] { return source_gen(); }}},
+                  {"filter", FilterNodeOptions{greater(field_ref("i32"),
+                                                       field_ref("threshold"))}},
+                  // the second parameter referenced by position past the input fields
+                  {"project", ProjectNodeOptions{{call("add", {field_ref("i32"),
+                                                              field_ref(3)})},
+                                                 {"shifted"}}},
+                  {"sink", SinkNodeOptions{&sink_gen}},
+              }),
+              parameters_schema));
+
+  const auto& filter = util::get<Declaration>(
+      util::get<Declaration>(prepared.declaration.inputs[0]).inputs[0]);
+  EXPECT_TRUE(::arrow::internal::checked_cast<const FilterNodeOptions&>(*filter.options)
+                  .filter_expression.IsBound());
+
+  for (auto values : {std::make_pair(4, 10), std::make_pair(5, 0)}) {
+    ASSERT_OK_AND_ASSIGN(auto decl, prepared.Instantiate({Datum(values.first),
+                                                          Datum(values.second)}));
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    ASSERT_OK(decl.AddToPlan(plan.get()));
+    source_gen = input.gen(/*parallel=*/false, /*slow=*/false);
+
+    auto expected = values.first == 4 ? "[[15], [16], [17]]" : "[[6], [7]]";
+    ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+                Finishes(ResultWith(UnorderedElementsAreArray(
+                    {ExecBatchFromJSON({int32()}, "[]"),
+                     ExecBatchFromJSON({int32()}, expected)}))));
+  }
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(TypeError, HasSubstr("Parameter threshold"),
+                                  prepared.Instantiate({Datum(int64_t(4)), Datum(0)}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, HasSubstr("Expected 2 parameters"),
+                                  prepared.Instantiate({Datum(4)}));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -91,6 +91,18 @@ inline void Hashing::helper_stripe(uint32_t offset, uint64_t mask_hi, const uint
 
 void Hashing::helper_stripes(int64_t hardware_flags, uint32_t num_keys,
                              uint32_t key_length, const uint8_t* keys, uint32_t* hash) {
+  // Keys of at most 8 bytes have no stripe and are entirely processed by helper_tails,
+  // starting from the combined initial accumulators.
+  if (key_length <= 8) {
+    const uint32_t acc_combined = combine_accumulators(
+        static_cast<uint32_t>(
+            (static_cast<uint64_t>(PRIME32_1) + static_cast<uint64_t>(PRIME32_2)) &
+            0xffffffff),
+        PRIME32_2, 0, static_cast<uint32_t>(-static_cast<int32_t>(PRIME32_1)));
+    std::fill(hash, hash + num_keys, acc_combined);
+    return;
+  }
+
   uint32_t processed = 0;
 #if defined(ARROW_HAVE_AVX2)
   if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
@@ -206,20 +218,11 @@ void Hashing::hash_varlen(int64_t hardware_flags, uint32_t num_rows,
     return;
   }
 #endif
-  static const uint64_t masks[9] = {0,
-                                    0xffULL,
-                                    0xffffULL,
-                                    0xffffffULL,
-                                    0xffffffffULL,
-                                    0xffffffffffULL,
-                                    0xffffffffffffULL,
-                                    0xffffffffffffffULL,
-                                    ~0ULL};
-
+  // Keys are processed as a sequence of 16B stripes, the last stripe being padded
+  // with zeros, so that the result matches hash_varlen_avx2.
   for (uint32_t i = 0; i < num_rows; ++i) {
     uint32_t offset = offsets[i];
     uint32_t key_length = offsets[i + 1] - offsets[i];
-    const uint32_t num_stripes = key_length / 16;
 
     uint32_t acc1, acc2, acc3, acc4;
     acc1 = static_cast<uint32_t>(
@@ -229,22 +232,18 @@ void Hashing::hash_varlen(int64_t hardware_flags, uint32_t num_rows,
     acc3 = 0;
     acc4 = static_cast<uint32_t>(-static_cast<int32_t>(PRIME32_1));
 
-    for (uint32_t stripe = 0; stripe < num_stripes; ++stripe) {
-      helper_stripe(offset, ~0ULL, concatenated_keys, acc1, acc2, acc3, acc4);
-      offset += 16;
-    }
-    uint32_t key_length_remaining = key_length - num_stripes * 16;
-    if (key_length_remaining > 8) {
-      helper_stripe(offset, masks[key_length_remaining - 8], concatenated_keys, acc1,
-                    acc2, acc3, acc4);
-      hashes[i] = combine_accumulators(acc1, acc2, acc3, acc4);
-    } else if (key_length > 0) {
-      uint32_t acc_combined = combine_accumulators(acc1, acc2, acc3, acc4);
-      hashes[i] = helper_tail(offset, masks[key_length_remaining], concatenated_keys,
-                              acc_combined, key_length_remaining);
-    } else {
-      hashes[i] = combine_accumulators(acc1, acc2, acc3, acc4);
+    if (key_length > 0) {
+      const uint32_t num_stripes = (key_length - 1) / 16 + 1;
+      for (uint32_t stripe = 0; stripe < num_stripes - 1; ++stripe) {
+        helper_stripe(offset, ~0ULL, concatenated_keys, acc1, acc2, acc3, acc4);
+        offset += 16;
+      }
+      uint8_t last_stripe[16] = {0};
+      memcpy(last_stripe, concatenated_keys + offset,
+             key_length - (num_stripes - 1) * 16);
+      helper_stripe(0, ~0ULL, last_stripe, acc1, acc2, acc3, acc4);
     }
+    hashes[i] = combine_accumulators(acc1, acc2, acc3, acc4);
   }
   avalanche(hardware_flags, num_rows, hashes);
 }
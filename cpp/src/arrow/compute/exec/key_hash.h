@@ -32,6 +32,10 @@ namespace compute {
 // Implementations are based on xxh3 32-bit algorithm description from:
 // https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
 //
+// Hash values are exposed to users by the "hash_32" compute function, so they
+// must not change and the AVX2 code paths must produce the same results as the
+// scalar ones.
+//
 class Hashing {
  public:
   static void hash_fixed(int64_t hardware_flags, uint32_t num_keys, uint32_t length_key,
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/exec/key_encode.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CpuInfo;
+
+namespace compute {
+
+using KeyColumnArray = KeyEncoder::KeyColumnArray;
+
+KeyColumnArray ColumnArrayFromArray(const Array& array) {
+  using Metadata = KeyEncoder::KeyColumnMetadata;
+  const ArrayData& data = *array.data();
+  const uint8_t* validity = data.buffers[0] ? data.buffers[0]->data() : nullptr;
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return KeyColumnArray(Metadata(true, 0), array.length(), validity,
+                            data.buffers[1]->data(), nullptr);
+    case Type::STRING:
+      return KeyColumnArray(Metadata(false, sizeof(uint32_t)), array.length(),
+                            validity, data.buffers[1]->data(), data.buffers[2]->data());
+    default: {
+      const auto& type = checked_cast<const FixedWidthType&>(*array.type());
+      const int byte_width = type.bit_width() / 8;
+      return KeyColumnArray(Metadata(true, byte_width), array.length(), validity,
+                            data.buffers[1]->data(), nullptr);
+    }
+  }
+}
+
+std::vector<uint32_t> HashColumns(const ArrayVector& arrays, int64_t hardware_flags) {
+  const int64_t num_rows = arrays[0]->length();
+  std::vector<KeyColumnArray> columns;
+  for (const auto& array : arrays) {
+    columns.push_back(ColumnArrayFromArray(*array));
+  }
+  util::TempVectorStack stack;
+  ARROW_EXPECT_OK(stack.Init(default_memory_pool(), 1 << 16));
+  KeyEncoder::KeyEncoderContext ctx;
+  ctx.hardware_flags = hardware_flags;
+  ctx.stack = &stack;
+  std::vector<uint32_t> hashes(num_rows);
+  Hashing::HashMultiColumn(columns, &ctx, hashes.data());
+  return hashes;
+}
+
+TEST(KeyHash, ScalarAndAvx2Agree) {
+  // Hashes may be persisted, so they must not depend on the CPU features
+#ifndef ARROW_HAVE_AVX2
+  GTEST_SKIP() << "AVX2 support is not compiled in";
+#else
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    GTEST_SKIP() << "AVX2 is not supported by this CPU";
+  }
+  random::RandomArrayGenerator rng(/*seed=*/42);
+  // Odd lengths exercise the scalar tails of the AVX2 loops
+  for (int64_t length : {1, 7, 8, 9, 1000}) {
+    ArrayVector arrays{rng.ArrayOf(boolean(), length, /*null_probability=*/0.1),
+                       rng.ArrayOf(int8(), length, /*null_probability=*/0.1),
+                       rng.ArrayOf(int16(), length, /*null_probability=*/0.1),
+                       rng.ArrayOf(int32(), length, /*null_probability=*/0.1),
+                       rng.ArrayOf(int64(), length, /*null_probability=*/0.1),
+                       rng.String(length, 0, 50, /*null_probability=*/0.1)};
+    for (int32_t byte_width = 1; byte_width <= 40; ++byte_width) {
+      arrays.push_back(
+          rng.FixedSizeBinary(length, byte_width, /*null_probability=*/0.1));
+    }
+
+    for (const auto& array : arrays) {
+      ARROW_SCOPED_TRACE("length = ", length, ", type = ", array->type()->ToString());
+      ASSERT_EQ(HashColumns({array}, 0), HashColumns({array}, CpuInfo::AVX2));
+    }
+    ARROW_SCOPED_TRACE("length = ", length, ", all columns");
+    ASSERT_EQ(HashColumns(arrays, 0), HashColumns(arrays, CpuInfo::AVX2));
+  }
+#endif
+}
+
+}  // namespace compute
+}  // namespace arrow
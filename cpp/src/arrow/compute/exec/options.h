@@ -27,6 +27,7 @@
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec/expression.h"
 #include "arrow/util/async_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/optional.h"
 #include "arrow/util/visibility.h"
 
@@ -108,15 +109,23 @@ class ARROW_EXPORT AggregateNodeOptions : public ExecNodeOptions {
 
 /// \brief Add a sink node which forwards to an AsyncGenerator<ExecBatch>
 ///
-/// Emitted batches will not be ordered.
+/// Emitted batches will not be ordered unless sequence_output is set.
 class ARROW_EXPORT SinkNodeOptions : public ExecNodeOptions {
  public:
   explicit SinkNodeOptions(std::function<Future<util::optional<ExecBatch>>()>* generator,
-                           util::BackpressureOptions backpressure = {})
-      : generator(generator), backpressure(std::move(backpressure)) {}
+                           util::BackpressureOptions backpressure = {},
+                           bool sequence_output = false)
+      : generator(generator),
+        backpressure(std::move(backpressure)),
+        sequence_output(sequence_output) {}
 
   std::function<Future<util::optional<ExecBatch>>()>* generator;
   util::BackpressureOptions backpressure;
+  /// If true, batches are emitted in the order of ExecBatch::index. Batches which arrive
+  /// ahead of their predecessors are held until those arrive; held batches count
+  /// towards the backpressure limits, which therefore bound the reordering buffer.
+  /// Every input batch must have an index.
+  bool sequence_output;
 };
 
 class ARROW_EXPORT SinkNodeConsumer {
@@ -253,6 +262,15 @@ class ARROW_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
   // concatenated input schema (left fields then right fields) and can reference
   // fields that are not included in the output.
   Expression filter;
+  // if valid, completed once the right input has been consumed with a predicate on the
+  // left keys which every left row that can have a match satisfies.  Passing the same
+  // future to a scan on the left side allows it to skip fragments and row groups which
+  // cannot join (dynamic partition pruning).  Only supported for join types which drop
+  // unmatched left rows.
+  Future<Expression> dynamic_filter;
+  // number of distinct right keys up to which dynamic_filter lists them explicitly;
+  // above it only the range of each key is used
+  int64_t dynamic_filter_max_keys = 1024;
 };
 
 /// \brief Make a node which select top_k/bottom_k rows passed through it
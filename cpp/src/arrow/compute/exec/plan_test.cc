@@ -541,6 +541,99 @@ TEST(ExecPlanExecution, ConsumingSinkErrorFinish) {
   ASSERT_FINISHES_AND_RAISES(Invalid, plan->finished());
 }
 
+TEST(ExecPlanExecution, SequencedSinkNodeBackpressure) {
+  constexpr uint32_t kPauseIfAbove = 4;
+  constexpr uint32_t kResumeIfBelow = 2;
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+  util::BackpressureOptions backpressure_options =
+      util::BackpressureOptions::Make(kResumeIfBelow, kPauseIfAbove);
+
+  auto source = MakeDummyNode(plan.get(), "source", /*inputs=*/{}, /*num_outputs=*/1);
+  ASSERT_OK_AND_ASSIGN(
+      auto sink, MakeExecNode("sink", plan.get(), {source},
+                              SinkNodeOptions{&sink_gen, backpressure_options,
+                                              /*sequence_output=*/true}));
+  ASSERT_OK(plan->StartProducing());
+
+  auto make_batch = [](int64_t index) {
+    ExecBatch batch({MakeScalar(index)}, /*length=*/1);
+    batch.index = index;
+    return batch;
+  };
+
+  // Batches which arrive before batch 0 are held and count towards backpressure
+  for (int64_t i = 1; i <= kPauseIfAbove; i++) {
+    sink->InputReceived(source, make_batch(i));
+  }
+  ASSERT_TRUE(backpressure_options.toggle->IsOpen());
+  sink->InputReceived(source, make_batch(kPauseIfAbove + 1));
+  ASSERT_FALSE(backpressure_options.toggle->IsOpen());
+
+  // Once batch 0 arrives all held batches are emitted in order
+  sink->InputReceived(source, make_batch(0));
+  sink->InputFinished(source, kPauseIfAbove + 2);
+  for (int64_t i = 0; i <= kPauseIfAbove + 1; i++) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, sink_gen());
+    ASSERT_TRUE(batch.has_value());
+    ASSERT_EQ(batch->index, i);
+  }
+  ASSERT_TRUE(backpressure_options.toggle->IsOpen());
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto end, sink_gen());
+  ASSERT_FALSE(end.has_value());
+  ASSERT_FINISHES_OK(plan->finished());
+}
+
+TEST(ExecPlanExecution, SequencedSinkNodeRejectsUnsequencedBatches) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+  auto source = MakeDummyNode(plan.get(), "source", /*inputs=*/{}, /*num_outputs=*/1);
+  ASSERT_OK_AND_ASSIGN(
+      auto sink, MakeExecNode("sink", plan.get(), {source},
+                              SinkNodeOptions{&sink_gen, /*backpressure=*/{},
+                                              /*sequence_output=*/true}));
+  ASSERT_OK(plan->StartProducing());
+
+  sink->InputReceived(source, ExecBatch({MakeScalar(0)}, /*length=*/1));
+  ASSERT_FINISHES_AND_RAISES(Invalid, sink_gen());
+  ASSERT_FINISHES_OK(plan->finished());
+}
+
+TEST(ExecPlanExecution, SequencedSinkNodeRejectsDuplicateIndices) {
+  auto make_batch = [](int64_t index) {
+    ExecBatch batch({MakeScalar(index)}, /*length=*/1);
+    batch.index = index;
+    return batch;
+  };
+
+  // Index 0 was already emitted, index 2 is still held
+  for (int64_t duplicate_index : {0, 2}) {
+    ARROW_SCOPED_TRACE("duplicate index = ", duplicate_index);
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+    auto source = MakeDummyNode(plan.get(), "source", /*inputs=*/{}, /*num_outputs=*/1);
+    ASSERT_OK_AND_ASSIGN(
+        auto sink, MakeExecNode("sink", plan.get(), {source},
+                                SinkNodeOptions{&sink_gen, /*backpressure=*/{},
+                                                /*sequence_output=*/true}));
+    ASSERT_OK(plan->StartProducing());
+
+    sink->InputReceived(source, make_batch(0));
+    sink->InputReceived(source, make_batch(2));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, sink_gen());
+    ASSERT_TRUE(batch.has_value());
+    ASSERT_EQ(batch->index, 0);
+
+    sink->InputReceived(source, make_batch(duplicate_index));
+    EXPECT_FINISHES_AND_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("more than once"), sink_gen());
+    ASSERT_FINISHES_OK(plan->finished());
+  }
+}
+
 TEST(ExecPlanExecution, StressSourceSink) {
   for (bool slow : {false, true}) {
     SCOPED_TRACE(slow ? "slowed" : "unslowed");
@@ -570,6 +663,38 @@ TEST(ExecPlanExecution, StressSourceSink) {
   }
 }
 
+TEST(ExecPlanExecution, StressSourceFilterProjectSequencedSink) {
+  for (bool slow : {false, true}) {
+    SCOPED_TRACE(slow ? "slowed" : "unslowed");
+
+    for (bool parallel : {false, true}) {
+      SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+
+      int num_batches = (slow && !parallel) ? 30 : 300;
+
+      ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+      AsyncGenerator<util::optional<ExecBatch>> sink_gen;
+
+      auto random_data = MakeRandomBatches(
+          schema({field("a", int32()), field("b", boolean())}), num_batches);
+
+      ASSERT_OK(Declaration::Sequence(
+                    {
+                        {"source", SourceNodeOptions{random_data.schema,
+                                                     random_data.gen(parallel, slow)}},
+                        {"filter", FilterNodeOptions{literal(true)}},
+                        {"project", ProjectNodeOptions{{field_ref("a"), field_ref("b")}}},
+                        {"sink", SinkNodeOptions{&sink_gen, /*backpressure=*/{},
+                                                 /*sequence_output=*/true}},
+                    })
+                    .AddToPlan(plan.get()));
+
+      ASSERT_THAT(StartAndCollect(plan.get(), sink_gen),
+                  Finishes(ResultWith(ElementsAreArray(random_data.batches))));
+    }
+  }
+}
+
 TEST(ExecPlanExecution, StressSourceOrderBy) {
   auto input_schema = schema({field("a", int32()), field("b", boolean())});
   for (bool slow : {false, true}) {
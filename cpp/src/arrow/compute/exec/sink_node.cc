@@ -18,6 +18,7 @@
 
 #include "arrow/compute/exec/exec_plan.h"
 
+#include <map>
 #include <mutex>
 
 #include "arrow/compute/api_vector.h"
@@ -46,14 +47,129 @@ using internal::checked_cast;
 namespace compute {
 namespace {
 
+// Pushes batches to a PushGenerator in the order of ExecBatch::index, holding batches
+// which arrive ahead of their predecessors.
+//
+// Only one thread pushes at a time and it does so without holding the lock, since a
+// push may run consumer callbacks which feed further batches into the plan. If
+// backpressure is configured, both held batches and pushed batches which have not yet
+// been pulled count towards its limits.
+class SequencingProducer {
+ public:
+  using Producer = PushGenerator<util::optional<ExecBatch>>::Producer;
+
+  SequencingProducer(Producer producer, util::BackpressureOptions backpressure)
+      : producer_(std::move(producer)), backpressure_(std::move(backpressure)) {}
+
+  Status Push(ExecBatch batch) {
+    if (!batch.index.has_value()) {
+      return Status::Invalid("A sink with sequence_output received a batch with no index");
+    }
+    const int64_t index = *batch.index;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (index < next_index_ || held_.count(index) > 0) {
+      // Holding or emitting it would either drop a batch or emit it out of order
+      return Status::Invalid("A sink with sequence_output received a batch with index ",
+                             index, " more than once");
+    }
+    held_.emplace(index, std::move(batch));
+    Drain(std::move(lock));
+    return Status::OK();
+  }
+
+  // Push all held batches regardless of gaps, then invoke on_finished.
+  void Finish(std::function<void()> on_finished) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    on_finished_ = std::move(on_finished);
+    Drain(std::move(lock));
+  }
+
+  void OnPulled() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++num_pulled_;
+    UpdateBackpressure(std::move(lock));
+  }
+
+ private:
+  void Drain(std::unique_lock<std::mutex> lock) {
+    if (draining_) {
+      // the draining thread will push anything which became ready
+      return UpdateBackpressure(std::move(lock));
+    }
+    draining_ = true;
+
+    std::vector<ExecBatch> ready;
+    while (true) {
+      bool finishing = static_cast<bool>(on_finished_);
+      for (auto it = held_.begin();
+           it != held_.end() && (finishing || it->first == next_index_);
+           it = held_.erase(it)) {
+        next_index_ = it->first + 1;
+        ready.push_back(std::move(it->second));
+      }
+      if (ready.empty()) break;
+
+      num_pushed_ += static_cast<int64_t>(ready.size());
+      lock.unlock();
+      for (auto& batch : ready) {
+        producer_.Push(std::move(batch));
+      }
+      ready.clear();
+      lock.lock();
+    }
+    draining_ = false;
+
+    std::function<void()> on_finished;
+    std::swap(on_finished, on_finished_);
+    UpdateBackpressure(std::move(lock));
+
+    if (on_finished) on_finished();
+  }
+
+  void UpdateBackpressure(std::unique_lock<std::mutex> lock) {
+    if (!backpressure_.toggle) return;
+
+    int64_t buffered = static_cast<int64_t>(held_.size()) +
+                       std::max<int64_t>(num_pushed_ - num_pulled_, 0);
+    bool pause = !paused_ && buffered > backpressure_.pause_if_above;
+    bool resume = paused_ && buffered < backpressure_.resume_if_below;
+    if (pause || resume) paused_ = pause;
+    lock.unlock();
+
+    // Open might trigger callbacks so the lock must be released first
+    if (pause) backpressure_.toggle->Close();
+    if (resume) backpressure_.toggle->Open();
+  }
+
+  Producer producer_;
+  util::BackpressureOptions backpressure_;
+
+  std::mutex mutex_;
+  std::map<int64_t, ExecBatch> held_;
+  int64_t next_index_ = 0;
+  bool draining_ = false;
+  std::function<void()> on_finished_;
+
+  int64_t num_pushed_ = 0;
+  int64_t num_pulled_ = 0;
+  bool paused_ = false;
+};
+
 class SinkNode : public ExecNode {
  public:
   SinkNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
            AsyncGenerator<util::optional<ExecBatch>>* generator,
-           util::BackpressureOptions backpressure)
+           util::BackpressureOptions backpressure, bool sequence_output = false)
       : ExecNode(plan, std::move(inputs), {"collected"}, {},
                  /*num_outputs=*/0),
-        producer_(MakeProducer(generator, std::move(backpressure))) {}
+        producer_(MakeProducer(generator, sequence_output ? util::BackpressureOptions{}
+                                                          : backpressure)) {
+    if (sequence_output) {
+      // backpressure is applied by the sequencer, which also counts held batches
+      sequencer_ = std::make_shared<SequencingProducer>(producer_, std::move(backpressure));
+      *generator = MakeCountingGenerator(sequencer_, std::move(*generator));
+    }
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -61,7 +177,17 @@ class SinkNode : public ExecNode {
 
     const auto& sink_options = checked_cast<const SinkNodeOptions&>(options);
     return plan->EmplaceNode<SinkNode>(plan, std::move(inputs), sink_options.generator,
-                                       sink_options.backpressure);
+                                       sink_options.backpressure,
+                                       sink_options.sequence_output);
+  }
+
+  static AsyncGenerator<util::optional<ExecBatch>> MakeCountingGenerator(
+      std::shared_ptr<SequencingProducer> sequencer,
+      AsyncGenerator<util::optional<ExecBatch>> gen) {
+    return [sequencer, gen]() {
+      sequencer->OnPulled();
+      return gen();
+    };
   }
 
   static PushGenerator<util::optional<ExecBatch>>::Producer MakeProducer(
@@ -98,8 +224,13 @@ class SinkNode : public ExecNode {
   void InputReceived(ExecNode* input, ExecBatch batch) override {
     DCHECK_EQ(input, inputs_[0]);
 
-    bool did_push = producer_.Push(std::move(batch));
-    if (!did_push) return;  // producer_ was Closed already
+    if (sequencer_) {
+      Status st = sequencer_->Push(std::move(batch));
+      if (!st.ok()) return ErrorReceived(input, std::move(st));
+    } else {
+      bool did_push = producer_.Push(std::move(batch));
+      if (!did_push) return;  // producer_ was Closed already
+    }
 
     if (input_counter_.Increment()) {
       Finish();
@@ -125,6 +256,15 @@ class SinkNode : public ExecNode {
 
  protected:
   virtual void Finish() {
+    if (sequencer_) {
+      // batches after a gap (if an upstream node dropped a batch) are pushed in order
+      sequencer_->Finish([this] { CloseProducer(); });
+      return;
+    }
+    CloseProducer();
+  }
+
+  void CloseProducer() {
     if (producer_.Close()) {
       finished_.MarkFinished();
     }
@@ -134,6 +274,7 @@ class SinkNode : public ExecNode {
   Future<> finished_ = Future<>::MakeFinished();
 
   PushGenerator<util::optional<ExecBatch>>::Producer producer_;
+  std::shared_ptr<SequencingProducer> sequencer_;
 };
 
 // A sink node that owns consuming the data and will not finish until the consumption
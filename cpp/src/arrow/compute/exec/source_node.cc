@@ -105,6 +105,7 @@ struct SourceNode : ExecNode {
                 }
                 lock.unlock();
                 ExecBatch batch = std::move(*maybe_batch);
+                batch.index = total_batches;
 
                 if (executor) {
                   auto status =
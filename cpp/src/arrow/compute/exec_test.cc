@@ -886,6 +886,56 @@ TEST_F(TestCallScalarFunction, ScalarFunction) {
   ASSERT_TRUE(expected->Equals(*result.scalar()));
 }
 
+TEST_F(TestCallScalarFunction, FunctionExecutor) {
+  auto multiplier = std::make_shared<Int32Scalar>(2);
+  ExampleOptions options(multiplier);
+  ASSERT_OK_AND_ASSIGN(auto executor,
+                       GetFunctionExecutor("test_stateful", {int32()}, &options));
+
+  // The bound kernel and its state are reused across calls
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       executor->Execute({ArrayFromJSON(int32(), "[1, 2, null]")}));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 4, null]"), *result.make_array());
+  ASSERT_OK_AND_ASSIGN(result, executor->Execute({ArrayFromJSON(int32(), "[5]")}));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[10]"), *result.make_array());
+
+  // Re-initializing with other options
+  ExampleOptions other_options(std::make_shared<Int32Scalar>(3));
+  ASSERT_OK(executor->Init(&other_options));
+  ASSERT_OK_AND_ASSIGN(result, executor->Execute({ArrayFromJSON(int32(), "[5]")}));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[15]"), *result.make_array());
+
+  // Arguments must match the bound types
+  ASSERT_RAISES(TypeError, executor->Execute({ArrayFromJSON(int64(), "[5]")}));
+  ASSERT_RAISES(TypeError, executor->Execute({}));
+  ASSERT_RAISES(NotImplemented, GetFunctionExecutor("test_stateful", {int64()}));
+}
+
+TEST(FunctionExecutor, ImplicitCasts) {
+  ASSERT_OK_AND_ASSIGN(auto executor, GetFunctionExecutor("add", {int32(), int64()}));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         executor->Execute({ArrayFromJSON(int32(), "[1, null, 3]"),
+                                            ArrayFromJSON(int64(), "[10, 20, 30]")}));
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[11, null, 33]"), *result.make_array());
+  }
+}
+
+TEST(FunctionExecutor, ResetsAccumulatedState) {
+  // Aggregate and vector kernel state must not leak into the next call
+  ASSERT_OK_AND_ASSIGN(auto sum, GetFunctionExecutor("sum", {int64()}));
+  ASSERT_OK_AND_ASSIGN(Datum result, sum->Execute({ArrayFromJSON(int64(), "[1, 2]")}));
+  AssertScalarsEqual(Int64Scalar(3), *result.scalar());
+  ASSERT_OK_AND_ASSIGN(result, sum->Execute({ArrayFromJSON(int64(), "[4]")}));
+  AssertScalarsEqual(Int64Scalar(4), *result.scalar());
+
+  ASSERT_OK_AND_ASSIGN(auto unique, GetFunctionExecutor("unique", {int32()}));
+  ASSERT_OK_AND_ASSIGN(result, unique->Execute({ArrayFromJSON(int32(), "[1, 2, 1]")}));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2]"), *result.make_array());
+  ASSERT_OK_AND_ASSIGN(result, unique->Execute({ArrayFromJSON(int32(), "[3, 1]")}));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 1]"), *result.make_array());
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
@@ -202,13 +202,151 @@ Result<const Kernel*> Function::DispatchBest(std::vector<ValueDescr>* values) co
   return DispatchExact(*values);
 }
 
+namespace detail {
+
+namespace {
+
+Result<std::unique_ptr<KernelExecutor>> MakeKernelExecutor(Function::Kind kind) {
+  switch (kind) {
+    case Function::SCALAR:
+      return KernelExecutor::MakeScalar();
+    case Function::VECTOR:
+      return KernelExecutor::MakeVector();
+    case Function::SCALAR_AGGREGATE:
+      return KernelExecutor::MakeScalarAggregate();
+    default:
+      return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
+  }
+}
+
+class FunctionExecutorImpl : public FunctionExecutor {
+ public:
+  FunctionExecutorImpl(const Function& func, std::vector<ValueDescr> in_descrs,
+                       std::vector<ValueDescr> kernel_descrs, const Kernel* kernel,
+                       std::unique_ptr<KernelExecutor> executor)
+      : func_(func),
+        in_descrs_(std::move(in_descrs)),
+        kernel_descrs_(std::move(kernel_descrs)),
+        kernel_(kernel),
+        executor_(std::move(executor)),
+        kernel_ctx_(nullptr) {}
+
+  Status Init(const FunctionOptions* options, ExecContext* exec_ctx) override {
+    if (options == nullptr) {
+      RETURN_NOT_OK(CheckOptions(func_, options));
+      options = func_.default_options();
+    }
+    if (exec_ctx == nullptr) {
+      if (default_exec_ctx_ == nullptr) {
+        default_exec_ctx_.reset(new ExecContext());
+      }
+      exec_ctx = default_exec_ctx_.get();
+    }
+    options_ = options;
+    kernel_ctx_ = KernelContext{exec_ctx};
+    return InitKernel();
+  }
+
+  Result<Datum> Execute(const std::vector<Datum>& args) override {
+    if (!initialized_) {
+      RETURN_NOT_OK(Init(nullptr, nullptr));
+    } else if (state_consumed_) {
+      RETURN_NOT_OK(InitKernel());
+    }
+    RETURN_NOT_OK(CheckArgs(args));
+    ARROW_ASSIGN_OR_RAISE(auto implicitly_cast_args,
+                          Cast(args, kernel_descrs_, kernel_ctx_.exec_context()));
+
+    // Scalar kernel state only depends on the options, but the state of vector
+    // and aggregate kernels accumulates the input and must be reset before the
+    // next call
+    state_consumed_ = func_.kind() != Function::SCALAR;
+
+    DatumAccumulator listener;
+    RETURN_NOT_OK(executor_->Execute(implicitly_cast_args, &listener));
+    const auto out = executor_->WrapResults(implicitly_cast_args, listener.values());
+#ifndef NDEBUG
+    DCHECK_OK(executor_->CheckResultType(out, func_.name().c_str()));
+#endif
+    return out;
+  }
+
+ private:
+  Status InitKernel() {
+    initialized_ = false;
+    state_.reset();
+    kernel_ctx_.SetState(nullptr);
+    if (kernel_->init) {
+      ARROW_ASSIGN_OR_RAISE(
+          state_, kernel_->init(&kernel_ctx_, {kernel_, kernel_descrs_, options_}));
+      kernel_ctx_.SetState(state_.get());
+    }
+    RETURN_NOT_OK(executor_->Init(&kernel_ctx_, {kernel_, kernel_descrs_, options_}));
+    initialized_ = true;
+    state_consumed_ = false;
+    return Status::OK();
+  }
+
+  Status CheckArgs(const std::vector<Datum>& args) const {
+    RETURN_NOT_OK(CheckAllValues(args));
+    bool matches = args.size() == in_descrs_.size();
+    for (size_t i = 0; matches && i < args.size(); ++i) {
+      const ValueDescr descr = args[i].descr();
+      matches = descr == in_descrs_[i] || descr == kernel_descrs_[i];
+    }
+    if (!matches) {
+      std::vector<ValueDescr> descrs(args.size());
+      for (size_t i = 0; i < args.size(); ++i) {
+        descrs[i] = args[i].descr();
+      }
+      return Status::TypeError("Function '", func_.name(), "' was bound to arguments ",
+                               ValueDescr::ToString(in_descrs_), " but called with ",
+                               ValueDescr::ToString(descrs));
+    }
+    return Status::OK();
+  }
+
+  const Function& func_;
+  const std::vector<ValueDescr> in_descrs_;
+  const std::vector<ValueDescr> kernel_descrs_;
+  const Kernel* kernel_;
+  std::unique_ptr<KernelExecutor> executor_;
+
+  std::unique_ptr<ExecContext> default_exec_ctx_;
+  const FunctionOptions* options_ = nullptr;
+  KernelContext kernel_ctx_;
+  std::unique_ptr<KernelState> state_;
+  bool initialized_ = false;
+  bool state_consumed_ = false;
+};
+
+}  // namespace
+
+}  // namespace detail
+
+Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
+    std::vector<ValueDescr> values) const {
+  for (auto& descr : values) {
+    // Unspecified shapes bind to array arguments
+    if (descr.shape == ValueDescr::ANY) {
+      descr.shape = ValueDescr::ARRAY;
+    }
+  }
+  std::vector<ValueDescr> kernel_descrs = values;
+  ARROW_ASSIGN_OR_RAISE(auto kernel, DispatchBest(&kernel_descrs));
+  ARROW_ASSIGN_OR_RAISE(auto executor, detail::MakeKernelExecutor(kind()));
+  return std::make_shared<detail::FunctionExecutorImpl>(
+      *this, std::move(values), std::move(kernel_descrs), kernel, std::move(executor));
+}
+
 Result<Datum> Function::Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const {
   if (options == nullptr) {
     RETURN_NOT_OK(CheckOptions(*this, options));
-    options = default_options();
   }
   if (ctx == nullptr) {
+    // Keep the default context on the stack, so that the executor does not
+    // allocate one
     ExecContext default_ctx;
     return Execute(args, options, &default_ctx);
   }
@@ -220,37 +358,17 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
   for (size_t i = 0; i != args.size(); ++i) {
     inputs[i] = args[i].descr();
   }
+  std::vector<ValueDescr> kernel_descrs = inputs;
 
-  ARROW_ASSIGN_OR_RAISE(auto kernel, DispatchBest(&inputs));
-  ARROW_ASSIGN_OR_RAISE(auto implicitly_cast_args, Cast(args, inputs, ctx));
-
-  std::unique_ptr<KernelState> state;
-
-  KernelContext kernel_ctx{ctx};
-  if (kernel->init) {
-    ARROW_ASSIGN_OR_RAISE(state, kernel->init(&kernel_ctx, {kernel, inputs, options}));
-    kernel_ctx.SetState(state.get());
-  }
-
-  std::unique_ptr<detail::KernelExecutor> executor;
-  if (kind() == Function::SCALAR) {
-    executor = detail::KernelExecutor::MakeScalar();
-  } else if (kind() == Function::VECTOR) {
-    executor = detail::KernelExecutor::MakeVector();
-  } else if (kind() == Function::SCALAR_AGGREGATE) {
-    executor = detail::KernelExecutor::MakeScalarAggregate();
-  } else {
-    return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
-  }
-  RETURN_NOT_OK(executor->Init(&kernel_ctx, {kernel, inputs, options}));
+  ARROW_ASSIGN_OR_RAISE(auto kernel, DispatchBest(&kernel_descrs));
+  ARROW_ASSIGN_OR_RAISE(auto kernel_executor, detail::MakeKernelExecutor(kind()));
 
-  detail::DatumAccumulator listener;
-  RETURN_NOT_OK(executor->Execute(implicitly_cast_args, &listener));
-  const auto out = executor->WrapResults(implicitly_cast_args, listener.values());
-#ifndef NDEBUG
-  DCHECK_OK(executor->CheckResultType(out, name_.c_str()));
-#endif
-  return out;
+  // A one-shot call can keep its executor on the stack
+  detail::FunctionExecutorImpl executor(*this, std::move(inputs),
+                                        std::move(kernel_descrs), kernel,
+                                        std::move(kernel_executor));
+  RETURN_NOT_OK(executor.Init(options, ctx));
+  return executor.Execute(args);
 }
 
 namespace {
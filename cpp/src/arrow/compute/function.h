@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -159,6 +160,33 @@ struct ARROW_EXPORT FunctionDoc {
   static const FunctionDoc& Empty();
 };
 
+/// \brief A function call bound to a kernel for fixed argument types
+///
+/// Kernel dispatch and implicit cast resolution are done once when the
+/// executor is obtained (see Function::GetBestExecutor and
+/// GetFunctionExecutor), and kernel state is initialized once per Init(), so
+/// repeated calls on new data of the same types only pay for the kernel
+/// execution itself.  A FunctionExecutor is not thread-safe.
+class ARROW_EXPORT FunctionExecutor {
+ public:
+  virtual ~FunctionExecutor() = default;
+
+  /// \brief Initialize or re-initialize the kernel with the given options
+  ///
+  /// If `options` is null, the function's default options are used.  If
+  /// `exec_ctx` is null, a default ExecContext is used.  The options and
+  /// context must remain valid as long as Execute() is called.
+  virtual Status Init(const FunctionOptions* options = NULLPTR,
+                      ExecContext* exec_ctx = NULLPTR) = 0;
+
+  /// \brief Execute the bound kernel on arguments matching the bound types
+  ///
+  /// Arguments are cast to the kernel's input types if dispatch required an
+  /// implicit cast.  If Init() was not called yet, it is called with default
+  /// arguments.
+  virtual Result<Datum> Execute(const std::vector<Datum>& args) = 0;
+};
+
 /// \brief Base class for compute functions. Function implementations contain a
 /// collection of "kernels" which are implementations of the function for
 /// specific argument types. Selecting a viable kernel for executing a function
@@ -225,6 +253,15 @@ class ARROW_EXPORT Function {
   /// are responsible for casting inputs to the type and shape required by the kernel.
   virtual Result<const Kernel*> DispatchBest(std::vector<ValueDescr>* values) const;
 
+  /// \brief Return an executor bound to the best-match kernel for the given
+  /// argument types
+  ///
+  /// The returned executor accepts arguments of exactly the given types and
+  /// shapes, and applies the implicit casts chosen by DispatchBest.  A
+  /// descriptor of shape ANY binds to array (or chunked array) arguments.
+  virtual Result<std::shared_ptr<FunctionExecutor>> GetBestExecutor(
+      std::vector<ValueDescr> values) const;
+
   /// \brief Execute the function eagerly with the passed input arguments with
   /// kernel dispatch, batch iteration, and memory allocation details taken
   /// care of.
@@ -149,6 +149,26 @@ void BM_ExecuteScalarFunctionOnScalar(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * N);
 }
 
+void BM_ExecuteBoundScalarFunctionOnScalar(benchmark::State& state) {
+  // Execute a trivial function, with argument dispatch done once by binding
+  const int64_t N = 10000;
+
+  ASSERT_OK_AND_ASSIGN(auto executor,
+                       GetFunctionExecutor("is_valid", {ValueDescr::Scalar(int64())}));
+  const auto scalars = MakeScalarsForIsValid(N);
+
+  for (auto _ : state) {
+    int64_t total = 0;
+    for (const auto& scalar : scalars) {
+      const Datum result = *executor->Execute({Datum(scalar)});
+      total += result.scalar()->is_valid;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
 void BM_ExecuteScalarKernelOnScalar(benchmark::State& state) {
   // Execute a trivial function, with argument dispatch outside the hot path
   const int64_t N = 10000;
@@ -211,6 +231,7 @@ BENCHMARK(BM_CastDispatch);
 BENCHMARK(BM_CastDispatchBaseline);
 BENCHMARK(BM_AddDispatch);
 BENCHMARK(BM_ExecuteScalarFunctionOnScalar);
+BENCHMARK(BM_ExecuteBoundScalarFunctionOnScalar);
 BENCHMARK(BM_ExecuteScalarKernelOnScalar);
 BENCHMARK(BM_ExecBatchIterator)->RangeMultiplier(4)->Range(1024, 64 * 1024);
 
@@ -29,6 +29,7 @@
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/datum.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -70,6 +71,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
+  options.emplace_back(new MatchSubstringSetOptions({"a", "bc"}));
+  options.emplace_back(
+      new MatchSubstringSetOptions({"a"}, {"b+", "^c"}, /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
   options.emplace_back(new SplitOptions(/*max_splits=*/2, /*reverse=*/true));
   options.emplace_back(new SplitPatternOptions("pattern"));
@@ -125,6 +129,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new PartitionNthOptions(/*pivot=*/42));
   options.emplace_back(new SelectKOptions(0, {}));
   options.emplace_back(new SelectKOptions(5, {{SortKey("key", SortOrder::Ascending)}}));
+  options.emplace_back(new CumulativeOptions());
+  options.emplace_back(
+      new CumulativeOptions(std::make_shared<Int64Scalar>(42), /*skip_nulls=*/true));
   options.emplace_back(new Utf8NormalizeOptions());
   options.emplace_back(new Utf8NormalizeOptions(Utf8NormalizeOptions::NFD));
 
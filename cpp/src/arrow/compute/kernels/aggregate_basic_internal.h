@@ -83,14 +83,18 @@ struct SumImpl : public ScalarAggregator {
       if (is_boolean_type<ArrowType>::value) {
         this->sum += static_cast<SumCType>(BooleanArray(data).true_count());
       } else {
-        this->sum += SumArray<CType, SumCType, SimdLevel>(*data);
+        AddCompensated(SumArray<CType, SumCType, SimdLevel>(*data), &this->sum,
+                       &this->compensation);
       }
     } else {
       const auto& data = *batch[0].scalar();
       this->count += data.is_valid * batch.length;
       this->nulls_observed = this->nulls_observed || !data.is_valid;
       if (data.is_valid) {
-        this->sum += internal::UnboxScalar<ArrowType>::Unbox(data) * batch.length;
+        AddCompensated(
+            static_cast<SumCType>(internal::UnboxScalar<ArrowType>::Unbox(data) *
+                                  batch.length),
+            &this->sum, &this->compensation);
       }
     }
     return Status::OK();
@@ -99,7 +103,8 @@ struct SumImpl : public ScalarAggregator {
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->count += other.count;
-    this->sum += other.sum;
+    AddCompensated(other.sum, &this->sum, &this->compensation);
+    AddCompensated(other.compensation, &this->sum, &this->compensation);
     this->nulls_observed = this->nulls_observed || other.nulls_observed;
     return Status::OK();
   }
@@ -109,14 +114,18 @@ struct SumImpl : public ScalarAggregator {
         (this->count < options.min_count)) {
       out->value = std::make_shared<OutputType>(out_type);
     } else {
-      out->value = std::make_shared<OutputType>(this->sum, out_type);
+      out->value = std::make_shared<OutputType>(this->total(), out_type);
     }
     return Status::OK();
   }
 
+  SumCType total() const { return CompensatedTotal(this->sum, this->compensation); }
+
   size_t count = 0;
   bool nulls_observed = false;
   SumCType sum = 0;
+  // Accumulated rounding error of `sum`, see AddCompensated
+  SumCType compensation = 0;
   std::shared_ptr<DataType> out_type;
   ScalarAggregateOptions options;
 };
@@ -188,7 +197,7 @@ struct MeanImpl : public SumImpl<ArrowType, SimdLevel> {
         (this->count < options.min_count)) {
       out->value = std::make_shared<DoubleScalar>();
     } else {
-      const double mean = static_cast<double>(this->sum) / this->count;
+      const double mean = static_cast<double>(this->total()) / this->count;
       out->value = std::make_shared<DoubleScalar>(mean);
     }
     return Status::OK();
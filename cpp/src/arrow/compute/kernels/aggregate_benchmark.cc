@@ -411,6 +411,22 @@ GROUP_BY_BENCHMARK(SumDoublesGroupedByMediumIntegerSet, [&] {
   BenchmarkGroupBy(state, {{"hash_sum", NULLPTR}}, {summand}, {key});
 });
 
+GROUP_BY_BENCHMARK(SumDoublesGroupedBySortedSmallIntegerSet, [&] {
+  auto summand = rng.Float64(args.size,
+                             /*min=*/0.0,
+                             /*max=*/1.0e14,
+                             /*null_probability=*/args.null_proportion,
+                             /*nan_probability=*/args.null_proportion / 10);
+
+  auto unsorted_key = rng.Int64(args.size,
+                                /*min=*/0,
+                                /*max=*/255);
+  // sorted keys produce long runs of identical group ids
+  auto key = Take(unsorted_key, *SortIndices(*unsorted_key)).ValueOrDie();
+
+  BenchmarkGroupBy(state, {{"hash_sum", NULLPTR}}, {summand}, {key});
+});
+
 GROUP_BY_BENCHMARK(SumDoublesGroupedByTinyIntStringPairSet, [&] {
   auto summand = rng.Float64(args.size,
                              /*min=*/0.0,
@@ -531,6 +547,32 @@ SUM_KERNEL_BENCHMARK(SumKernelInt16, Int16Type);
 SUM_KERNEL_BENCHMARK(SumKernelInt32, Int32Type);
 SUM_KERNEL_BENCHMARK(SumKernelInt64, Int64Type);
 
+//
+// Mean
+//
+
+template <typename ArrowType>
+static void MeanKernel(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(CType);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, args.null_proportion);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Mean(array).status());
+  }
+}
+
+#define MEAN_KERNEL_BENCHMARK(FuncName, Type)                                \
+  static void FuncName(benchmark::State& state) { MeanKernel<Type>(state); } \
+  BENCHMARK(FuncName)->Apply(SumKernelArgs)
+
+MEAN_KERNEL_BENCHMARK(MeanKernelFloat, FloatType);
+MEAN_KERNEL_BENCHMARK(MeanKernelDouble, DoubleType);
+MEAN_KERNEL_BENCHMARK(MeanKernelInt64, Int64Type);
+
 //
 // Mode
 //
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -151,7 +155,10 @@ enable_if_t<std::is_floating_point<SumType>::value, SumType> SumArray(
   }
 
   // number of inputs to accumulate before merging with another block
-  constexpr int kBlockSize = 16;  // same as numpy
+  constexpr int kBlockSize = 128;  // same as numpy
+  // number of independent partial sums inside a block; each one only depends on
+  // itself so that the compiler can keep them in a vector register
+  constexpr int kLanes = 8;  // same as numpy
   // levels (tree depth) = ceil(log2(len)) + 1, a bit larger than necessary
   const int levels = bit_util::Log2(static_cast<uint64_t>(data_size)) + 1;
   // temporary summation per level
@@ -181,6 +188,26 @@ enable_if_t<std::is_floating_point<SumType>::value, SumType> SumArray(
     root_level = std::max(root_level, cur_level);
   };
 
+  // sum `len` (at most kBlockSize) consecutive values, itself pairwise over lanes
+  auto sum_block = [&](const ValueType* v, uint64_t len) {
+    SumType lanes[kLanes] = {};
+    const uint64_t vectorized = len - len % kLanes;
+    for (uint64_t i = 0; i < vectorized; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        lanes[j] += func(v[i + j]);
+      }
+    }
+    for (uint64_t i = vectorized; i < len; ++i) {
+      lanes[i - vectorized] += func(v[i]);
+    }
+    for (int width = kLanes / 2; width > 0; width /= 2) {
+      for (int j = 0; j < width; ++j) {
+        lanes[j] += lanes[j + width];
+      }
+    }
+    return lanes[0];
+  };
+
   const ValueType* values = data.GetValues<ValueType>(1);
   VisitSetBitRunsVoid(data.buffers[0], data.offset, data.length,
                       [&](int64_t pos, int64_t len) {
@@ -190,20 +217,12 @@ enable_if_t<std::is_floating_point<SumType>::value, SumType> SumArray(
                         const uint64_t remains = static_cast<uint64_t>(len) % kBlockSize;
 
                         for (uint64_t i = 0; i < blocks; ++i) {
-                          SumType block_sum = 0;
-                          for (int j = 0; j < kBlockSize; ++j) {
-                            block_sum += func(v[j]);
-                          }
-                          reduce(block_sum);
+                          reduce(sum_block(v, kBlockSize));
                           v += kBlockSize;
                         }
 
                         if (remains > 0) {
-                          SumType block_sum = 0;
-                          for (uint64_t i = 0; i < remains; ++i) {
-                            block_sum += func(v[i]);
-                          }
-                          reduce(block_sum);
+                          reduce(sum_block(v, remains));
                         }
                       });
 
@@ -233,6 +252,45 @@ enable_if_t<!std::is_floating_point<SumType>::value, SumType> SumArray(
   return sum;
 }
 
+// Add `value` to a running sum of partial results (e.g. one per batch).  For
+// floating point, the rounding error of each addition is carried in
+// `compensation` (Neumaier's variant of Kahan summation) and must be added back
+// to `sum` with CompensatedTotal() when reading the result.
+template <typename SumType>
+enable_if_t<std::is_floating_point<SumType>::value> AddCompensated(
+    SumType value, SumType* sum, SumType* compensation) {
+  const SumType new_sum = *sum + value;
+  // Once the sum is infinite or NaN there is no rounding error to track, and
+  // computing it would give inf - inf = NaN
+  if (std::isfinite(new_sum)) {
+    if (std::abs(*sum) >= std::abs(value)) {
+      *compensation += (*sum - new_sum) + value;
+    } else {
+      *compensation += (value - new_sum) + *sum;
+    }
+  }
+  *sum = new_sum;
+}
+
+template <typename SumType>
+enable_if_t<!std::is_floating_point<SumType>::value> AddCompensated(
+    SumType value, SumType* sum, SumType* compensation) {
+  *sum += value;
+}
+
+// Read back a sum accumulated with AddCompensated()
+template <typename SumType>
+enable_if_t<std::is_floating_point<SumType>::value, SumType> CompensatedTotal(
+    SumType sum, SumType compensation) {
+  return std::isfinite(compensation) ? sum + compensation : sum;
+}
+
+template <typename SumType>
+enable_if_t<!std::is_floating_point<SumType>::value, SumType> CompensatedTotal(
+    SumType sum, SumType compensation) {
+  return sum + compensation;
+}
+
 template <typename ValueType, typename SumType, SimdLevel::type SimdLevel>
 SumType SumArray(const ArrayData& data) {
   return SumArray<ValueType, SumType, SimdLevel>(
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <queue>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
@@ -26,6 +27,8 @@
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/hashing.h"
 
 namespace arrow {
 namespace compute {
@@ -203,8 +206,7 @@ struct CountModer<BooleanType> {
   }
 };
 
-// copy and sort approach for floating points, decimals, or integers with wide
-// value range
+// copy and sort approach for decimals
 // O(n) space, O(nlogn) time
 template <typename T>
 struct SortModer {
@@ -278,9 +280,89 @@ struct SortModer {
   }
 };
 
-// pick counting or sorting approach per integers value range
+// count value occurrences in a hash table for floating points or integers with wide
+// value range
+// O(d) space for d distinct values, O(n) time
+template <typename T>
+struct HashModer {
+  using CType = typename TypeTraits<T>::CType;
+  using MemoTable = arrow::internal::ScalarMemoTable<CType>;
+
+  template <typename Type = T>
+  static enable_if_floating_point<Type, bool> IsNan(CType value) {
+    return value != value;
+  }
+
+  template <typename Type = T>
+  static enable_if_t<!is_floating_type<Type>::value, bool> IsNan(CType) {
+    return false;
+  }
+
+  Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const Datum& datum = batch[0];
+    const int64_t in_length = datum.length() - datum.null_count();
+
+    const ModeOptions& options = ModeState::Get(ctx);
+    if ((!options.skip_nulls && datum.null_count() > 0) ||
+        (in_length < options.min_count)) {
+      return PrepareOutput<T>(/*n=*/0, ctx, out).status();
+    }
+
+    // count occurrences per distinct value, nans are counted apart
+    MemoTable memo_table(ctx->memory_pool(), 0);
+    std::vector<uint64_t> counts;  // counts[i]: # of values with memo index i
+    uint64_t nan_count = 0;
+    auto on_found = [&](int32_t memo_index) { ++counts[memo_index]; };
+    auto on_not_found = [&](int32_t memo_index) { counts.push_back(1); };
+    for (const auto& array : datum.chunks()) {
+      const ArrayData& data = *array->data();
+      const CType* values = data.GetValues<CType>(1);
+      Status status;
+      arrow::internal::VisitSetBitRunsVoid(
+          data.buffers[0], data.offset, data.length, [&](int64_t pos, int64_t len) {
+            for (int64_t i = 0; i < len && status.ok(); ++i) {
+              // adding zero turns -0.0 into +0.0, so that both zeros are counted
+              // together as when sorting
+              const auto value = static_cast<CType>(values[pos + i] + CType(0));
+              if (IsNan(value)) {
+                ++nan_count;
+                continue;
+              }
+              int32_t unused_memo_index;
+              status = memo_table.GetOrInsert(value, on_found, on_not_found,
+                                              &unused_memo_index);
+            }
+          });
+      RETURN_NOT_OK(status);
+    }
+
+    std::vector<CType> distinct_values(memo_table.size());
+    memo_table.CopyValues(distinct_values.data());
+
+    // generator to emit next value:count pair
+    size_t index = 0;
+    auto gen = [&]() {
+      if (ARROW_PREDICT_FALSE(index == distinct_values.size())) {
+        // handle NAN at last
+        if (nan_count > 0) {
+          auto value_count = std::make_pair(SortModer<T>::GetNan(), nan_count);
+          nan_count = 0;
+          return value_count;
+        }
+        return std::pair<CType, uint64_t>(static_cast<CType>(0), kCountEOF);
+      }
+      auto value_count = std::make_pair(distinct_values[index], counts[index]);
+      ++index;
+      return value_count;
+    };
+
+    return Finalize<T>(ctx, out, std::move(gen));
+  }
+};
+
+// pick counting or hashing approach per integers value range
 template <typename T>
-struct CountOrSortModer {
+struct CountOrHashModer {
   using CType = typename T::c_type;
 
   Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
@@ -299,7 +381,7 @@ struct CountOrSortModer {
       }
     }
 
-    return SortModer<T>().Exec(ctx, batch, out);
+    return HashModer<T>().Exec(ctx, batch, out);
   }
 };
 
@@ -326,12 +408,12 @@ struct Moder<BooleanType> {
 template <typename InType>
 struct Moder<InType, enable_if_t<(is_integer_type<InType>::value &&
                                   (sizeof(typename InType::c_type) > 1))>> {
-  CountOrSortModer<InType> impl;
+  CountOrHashModer<InType> impl;
 };
 
 template <typename InType>
 struct Moder<InType, enable_if_floating_point<InType>> {
-  SortModer<InType> impl;
+  HashModer<InType> impl;
 };
 
 template <typename InType>
@@ -15,13 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/bit_run_reader.h"
 
 namespace arrow {
 namespace compute {
@@ -359,7 +362,140 @@ struct CountQuantiler {
   }
 };
 
-// histogram or 'copy & nth_element' approach per value range and size, only for integers
+// radix selection approach with constant memory, only for integers
+// each selection makes one pass over the input per 16 bits of the value type and
+// counts the next 16 bits of the values sharing the already selected prefix
+template <typename InType>
+struct RadixSelectQuantiler {
+  using CType = typename InType::c_type;
+  using UType = typename std::make_unsigned<CType>::type;
+
+  static constexpr int kValueBits = sizeof(CType) * 8;
+  static constexpr int kDigitBits = 16;
+  static constexpr UType kDigitMask = static_cast<UType>((1U << kDigitBits) - 1);
+  // flipping the sign bit maps signed values to unsigned keys of the same order
+  static constexpr UType kSignFlip =
+      std::is_signed<CType>::value ? static_cast<UType>(UType(1) << (kValueBits - 1))
+                                   : UType(0);
+
+  std::vector<uint64_t> counts;  // counts[i]: # of candidates whose next digit is i
+
+  RadixSelectQuantiler() : counts(1U << kDigitBits) {}
+
+  Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const QuantileOptions& options = QuantileState::Get(ctx);
+
+    const Datum& datum = batch[0];
+    int64_t in_length = 0;
+    if ((options.skip_nulls || (!options.skip_nulls && datum.null_count() == 0)) &&
+        (datum.length() - datum.null_count() >= options.min_count)) {
+      in_length = datum.length() - datum.null_count();
+    }
+
+    // prepare out array
+    // out type depends on options
+    const bool is_datapoint = IsDataPoint(options);
+    const std::shared_ptr<DataType> out_type =
+        is_datapoint ? TypeTraits<InType>::type_singleton() : float64();
+    int64_t out_length = options.q.size();
+    if (in_length == 0) {
+      return MakeArrayOfNull(out_type, out_length, ctx->memory_pool()).Value(out);
+    }
+    auto out_data = ArrayData::Make(out_type, out_length, 0);
+    out_data->buffers.resize(2, nullptr);
+
+    // calculate quantiles
+    if (out_length > 0) {
+      ARROW_ASSIGN_OR_RAISE(out_data->buffers[1],
+                            ctx->Allocate(out_length * GetBitWidth(*out_type) / 8));
+
+      if (is_datapoint) {
+        CType* out_buffer = out_data->template GetMutableValues<CType>(1);
+        for (int64_t i = 0; i < out_length; ++i) {
+          const uint64_t datapoint_index =
+              QuantileToDataPoint(in_length, options.q[i], options.interpolation);
+          uint64_t ties_above;
+          out_buffer[i] = Select(datum, datapoint_index, &ties_above);
+        }
+      } else {
+        double* out_buffer = out_data->template GetMutableValues<double>(1);
+        for (int64_t i = 0; i < out_length; ++i) {
+          out_buffer[i] =
+              GetQuantileByInterp(datum, in_length, options.q[i], options.interpolation);
+        }
+      }
+    }
+
+    *out = Datum(std::move(out_data));
+    return Status::OK();
+  }
+
+  // return quantile interpolated from adjacent input data points
+  double GetQuantileByInterp(const Datum& datum, int64_t in_length, double q,
+                             enum QuantileOptions::Interpolation interpolation) {
+    const double index = (in_length - 1) * q;
+    const uint64_t lower_index = static_cast<uint64_t>(index);
+    const double fraction = index - lower_index;
+
+    uint64_t ties_above;
+    const double lower_value =
+        static_cast<double>(Select(datum, lower_index, &ties_above));
+    if (fraction == 0) {
+      return lower_value;
+    }
+    // the higher data point is either a copy of the lower one or the next larger value
+    const double higher_value =
+        ties_above > 0 ? lower_value
+                       : static_cast<double>(Select(datum, lower_index + 1, &ties_above));
+
+    if (interpolation == QuantileOptions::LINEAR) {
+      return fraction * higher_value + (1 - fraction) * lower_value;
+    } else if (interpolation == QuantileOptions::MIDPOINT) {
+      return lower_value / 2 + higher_value / 2;
+    } else {
+      DCHECK(false);
+      return NAN;
+    }
+  }
+
+  // return the value of rank `rank` (0-based) among the non-null input values,
+  // `*ties_above` receives the number of equal values ranked after it
+  CType Select(const Datum& datum, uint64_t rank, uint64_t* ties_above) {
+    UType prefix = 0;
+    UType prefix_mask = 0;
+    uint64_t digit_count = 0;
+    for (int shift = kValueBits - kDigitBits; shift >= 0; shift -= kDigitBits) {
+      std::fill(counts.begin(), counts.end(), 0);
+      for (const auto& array : datum.chunks()) {
+        const ArrayData& data = *array->data();
+        const CType* values = data.GetValues<CType>(1);
+        arrow::internal::VisitSetBitRunsVoid(
+            data.buffers[0], data.offset, data.length, [&](int64_t pos, int64_t len) {
+              for (int64_t i = 0; i < len; ++i) {
+                const UType key = static_cast<UType>(values[pos + i]) ^ kSignFlip;
+                if ((key & prefix_mask) == prefix) {
+                  ++counts[(key >> shift) & kDigitMask];
+                }
+              }
+            });
+      }
+      size_t digit = 0;
+      while (rank >= counts[digit]) {
+        rank -= counts[digit];
+        ++digit;
+      }
+      DCHECK_LT(digit, counts.size());
+      prefix = static_cast<UType>(prefix | (static_cast<UType>(digit) << shift));
+      prefix_mask = static_cast<UType>(prefix_mask | (kDigitMask << shift));
+      digit_count = counts[digit];
+    }
+    *ties_above = digit_count - rank - 1;
+    return static_cast<CType>(prefix ^ kSignFlip);
+  }
+};
+
+// histogram, radix selection or 'copy & nth_element' approach per value range, size
+// and number of quantiles, only for integers
 template <typename InType>
 struct CountOrSortQuantiler {
   using CType = typename InType::c_type;
@@ -369,6 +505,9 @@ struct CountOrSortQuantiler {
     // parameters estimated from ad-hoc benchmarks manually
     static constexpr int kMinArraySize = 65536;
     static constexpr int kMaxValueRange = 65536;
+    // radix selection makes up to four passes over the input per quantile, which
+    // beats copying and partitioning the input for a few quantiles only
+    static constexpr size_t kMaxRadixSelectQuantiles = 2;
 
     const Datum& datum = batch[0];
     if (datum.length() - datum.null_count() >= kMinArraySize) {
@@ -378,6 +517,9 @@ struct CountOrSortQuantiler {
       if (static_cast<uint64_t>(max) - static_cast<uint64_t>(min) <= kMaxValueRange) {
         return CountQuantiler<InType>(min, max).Exec(ctx, batch, out);
       }
+      if (QuantileState::Get(ctx).q.size() <= kMaxRadixSelectQuantiles) {
+        return RadixSelectQuantiler<InType>().Exec(ctx, batch, out);
+      }
     }
 
     return SortQuantiler<InType>().Exec(ctx, batch, out);
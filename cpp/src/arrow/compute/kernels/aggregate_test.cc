@@ -494,6 +494,55 @@ TEST_F(TestSumKernelRoundOff, Basics) {
   ASSERT_EQ(sum->value, 2756346749973250.0);
 }
 
+TEST_F(TestSumKernelRoundOff, ManyChunks) {
+  // Each chunk is summed separately; adding the small chunk sums to a large
+  // running total must not lose them
+  std::vector<std::string> chunks = {"[1e16]"};
+  for (int i = 0; i < 1000; ++i) {
+    chunks.push_back("[0.5, 0.5]");
+  }
+  chunks.push_back("[-1e16]");
+  auto array = ChunkedArrayFromJSON(float64(), chunks);
+
+  ASSERT_OK_AND_ASSIGN(Datum sum, Sum(array));
+  AssertDatumsEqual(Datum(1000.0), sum);
+  ASSERT_OK_AND_ASSIGN(Datum mean, Mean(array));
+  AssertDatumsEqual(Datum(1000.0 / 2002), mean);
+}
+
+TEST_F(TestSumKernelRoundOff, NonFinite) {
+  // The compensation term must not turn infinite sums into NaN
+  auto check = [](const Datum& input, double expected) {
+    ARROW_SCOPED_TRACE("input = ", input.ToString());
+    for (auto func : {Sum, Mean}) {
+      ASSERT_OK_AND_ASSIGN(Datum result, func(input, ScalarAggregateOptions::Defaults(),
+                                              nullptr));
+      const double value = checked_cast<const DoubleScalar&>(*result.scalar()).value;
+      if (std::isnan(expected)) {
+        ASSERT_TRUE(std::isnan(value)) << value;
+      } else {
+        ASSERT_EQ(expected, value);
+      }
+    }
+  };
+
+  check(ArrayFromJSON(float64(), "[Inf]"), INFINITY);
+  check(ArrayFromJSON(float64(), "[-Inf]"), -INFINITY);
+  check(ArrayFromJSON(float64(), "[1, 2, Inf, 4]"), INFINITY);
+  check(ArrayFromJSON(float64(), "[1, -Inf, 2, 4]"), -INFINITY);
+  check(ArrayFromJSON(float64(), "[1, Inf, -Inf, 4]"), NAN);
+
+  // Infinities in separate chunks go through the running sum and MergeFrom
+  check(ChunkedArrayFromJSON(float64(), {"[1, 2]", "[Inf]", "[4]"}), INFINITY);
+  check(ChunkedArrayFromJSON(float64(), {"[1, 2]", "[-Inf]", "[4]"}), -INFINITY);
+  check(ChunkedArrayFromJSON(float64(), {"[Inf]", "[1]", "[-Inf]"}), NAN);
+
+  // Overflow across chunks
+  check(ChunkedArrayFromJSON(float64(), {"[1e308]", "[1e308]"}), INFINITY);
+  check(ChunkedArrayFromJSON(float64(), {"[-1e308]", "[-1e308]", "[1]"}), -INFINITY);
+  check(ChunkedArrayFromJSON(float64(), {"[1e308]", "[1e308]", "[-Inf]"}), NAN);
+}
+
 TEST(TestDecimalSumKernel, SimpleSum) {
   for (const auto& ty : {decimal128(3, 2), decimal256(3, 2)}) {
     EXPECT_THAT(Sum(ArrayFromJSON(ty, R"([])")),
@@ -2638,6 +2687,7 @@ TYPED_TEST(TestFloatingModeKernel, Floats) {
   this->AssertModeIs("[5, 1, 1, 5, 5, 1]", 1, 3);
   this->AssertModeIs("[Inf, 100, Inf, 100, Inf]", INFINITY, 3);
   this->AssertModeIs("[Inf, -Inf, Inf, -Inf]", -INFINITY, 2);
+  this->AssertModeIs("[-0.0, 1, 0.0, 1, -0.0]", 0, 3);
 
   this->AssertModeIs("[null, null, 2, null, 1]", 1, 1);
   this->AssertModeIs("[NaN, NaN, 1, null, 1]", 1, 2);
@@ -2864,6 +2914,28 @@ TEST_F(TestInt32ModeKernel, LargeValueRange) {
   CheckModeWithRange<ArrowType>(-10000000, 10000000);
 }
 
+TEST_F(TestInt32ModeKernel, HashCounting) {
+  // Large value range and few distinct values => hash-based Mode implementation
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto indices = rand.Int32(32 * 1024, 0, 99, 0.1);
+  const auto& index_array = checked_cast<const Int32Array&>(*indices);
+  std::vector<int32_t> values(100);
+  for (int32_t i = 0; i < 100; ++i) {
+    values[i] = (i - 50) * 1000003;
+  }
+  Int32Builder builder;
+  for (int64_t i = 0; i < indices->length(); ++i) {
+    if (indices->IsNull(i)) {
+      ASSERT_OK(builder.AppendNull());
+    } else {
+      ASSERT_OK(builder.Append(values[index_array.Value(i)]));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  VerifyMode<ArrowType>(array);
+  VerifyMode<ArrowType>(array->Slice(1000, 5000));
+}
+
 TEST_F(TestInt32ModeKernel, Sliced) {
   CheckModeWithRangeSliced<ArrowType>(-100, 100);
   CheckModeWithRangeSliced<ArrowType>(-10000000, 10000000);
@@ -3515,6 +3587,16 @@ class TestRandomQuantileKernel : public TestPrimitiveQuantileKernel<ArrowType> {
                              NaiveQuantile(array, quantiles, this->interpolations_));
   }
 
+  void CheckQuantilesWideRange(int64_t array_size, std::vector<double> quantiles) {
+    std::shared_ptr<Array> array;
+    std::vector<double> unused;
+    // large value range to exercise radix selection for few quantiles
+    GenerateTestData(array_size, 1, -123456789, 123456789, &array, &unused);
+
+    this->AssertQuantilesAre(array, QuantileOptions{quantiles},
+                             NaiveQuantile(array, quantiles, this->interpolations_));
+  }
+
   void CheckQuantilesSliced(int64_t array_size, int64_t num_quantiles) {
     std::shared_ptr<Array> array;
     std::vector<double> quantiles;
@@ -3705,6 +3787,15 @@ TEST_F(TestRandomInt64QuantileKernel, Histogram) {
   this->CheckQuantiles(/*array_size=*/80000, /*num_quantiles=*/100);
 }
 
+TEST_F(TestRandomInt64QuantileKernel, RadixSelect) {
+  // exercise radix selection: size >= 65536, range > 65536, few quantiles
+  this->CheckQuantilesWideRange(/*array_size=*/80000, {0.5});
+  this->CheckQuantilesWideRange(/*array_size=*/80000, {0.1, 0.99});
+  this->CheckQuantilesWideRange(/*array_size=*/80001, {0, 1});
+  // too many quantiles => copy and sort
+  this->CheckQuantilesWideRange(/*array_size=*/80000, {0.1, 0.2, 0.33, 0.5, 0.9});
+}
+
 TEST_F(TestRandomInt64QuantileKernel, Sliced) {
   this->CheckQuantilesSliced(1000, 10);   // sort
   this->CheckQuantilesSliced(66000, 10);  // count
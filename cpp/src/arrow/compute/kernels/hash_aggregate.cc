@@ -41,6 +41,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_writer.h"
@@ -661,6 +662,73 @@ void VisitGroupedValuesNonNull(const ExecBatch& batch, ConsumeValue&& valid_func
                            [](uint32_t) {});
 }
 
+template <typename Type, typename CType = typename TypeTraits<Type>::CType>
+using is_arithmetic_value_type =
+    std::integral_constant<bool, !is_boolean_type<Type>::value &&
+                                     std::is_arithmetic<CType>::value>;
+
+// Visit grouped values as runs of consecutive non-null values which belong to the same
+// group: valid_run_func(g, values, length) may then accumulate a run in registers before
+// updating the state of group g once. Blocks of values without nulls are visited without
+// checking validity per value.
+template <typename Type, typename ConsumeValueRun, typename ConsumeNull>
+enable_if_t<is_arithmetic_value_type<Type>::value> VisitGroupedValueRuns(
+    const ExecBatch& batch, ConsumeValueRun&& valid_run_func, ConsumeNull&& null_func) {
+  using CType = typename TypeTraits<Type>::CType;
+  if (!batch[0].is_array()) {
+    VisitGroupedValues<Type>(
+        batch, [&](uint32_t g, CType val) { valid_run_func(g, &val, 1); },
+        std::forward<ConsumeNull>(null_func));
+    return;
+  }
+
+  const ArrayData& input = *batch[0].array();
+  const CType* values = input.GetValues<CType>(1);
+  const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+  const uint8_t* validity = input.GetValues<uint8_t>(0, 0);
+
+  arrow::internal::OptionalBitBlockCounter bit_counter(validity, input.offset,
+                                                       input.length);
+  int64_t position = 0;
+  while (position < input.length) {
+    const auto block = bit_counter.NextBlock();
+    const int64_t block_end = position + block.length;
+    if (block.AllSet()) {
+      while (position < block_end) {
+        int64_t run_end = position + 1;
+        while (run_end < block_end && g[run_end] == g[position]) {
+          ++run_end;
+        }
+        valid_run_func(g[position], values + position, run_end - position);
+        position = run_end;
+      }
+    } else if (block.NoneSet()) {
+      for (; position < block_end; ++position) {
+        null_func(g[position]);
+      }
+    } else {
+      for (; position < block_end; ++position) {
+        if (bit_util::GetBit(validity, input.offset + position)) {
+          valid_run_func(g[position], values + position, 1);
+        } else {
+          null_func(g[position]);
+        }
+      }
+    }
+  }
+}
+
+template <typename Type, typename ConsumeValueRun, typename ConsumeNull>
+enable_if_t<!is_arithmetic_value_type<Type>::value> VisitGroupedValueRuns(
+    const ExecBatch& batch, ConsumeValueRun&& valid_run_func, ConsumeNull&& null_func) {
+  VisitGroupedValues<Type>(
+      batch,
+      [&](uint32_t g, typename TypeTraits<Type>::CType val) {
+        valid_run_func(g, &val, 1);
+      },
+      std::forward<ConsumeNull>(null_func));
+}
+
 // ----------------------------------------------------------------------
 // Count implementation
 
@@ -780,11 +848,15 @@ struct GroupedReducingAggregator : public GroupedAggregator {
     int64_t* counts = counts_.mutable_data();
     uint8_t* no_nulls = no_nulls_.mutable_data();
 
-    VisitGroupedValues<Type>(
+    VisitGroupedValueRuns<Type>(
         batch,
-        [&](uint32_t g, InputCType value) {
-          reduced[g] = Impl::Reduce(*out_type_, reduced[g], value);
-          counts[g]++;
+        [&](uint32_t g, const InputCType* values, int64_t length) {
+          CType acc = reduced[g];
+          for (int64_t i = 0; i < length; ++i) {
+            acc = Impl::Reduce(*out_type_, acc, values[i]);
+          }
+          reduced[g] = acc;
+          counts[g] += length;
         },
         [&](uint32_t g) { bit_util::SetBitTo(no_nulls, g, false); });
     return Status::OK();
@@ -1637,11 +1709,17 @@ struct GroupedMinMaxImpl final : public GroupedAggregator {
     auto raw_mins = mins_.mutable_data();
     auto raw_maxes = maxes_.mutable_data();
 
-    VisitGroupedValues<Type>(
+    VisitGroupedValueRuns<Type>(
         batch,
-        [&](uint32_t g, CType val) {
-          GetSet::Set(raw_mins, g, std::min(GetSet::Get(raw_mins, g), val));
-          GetSet::Set(raw_maxes, g, std::max(GetSet::Get(raw_maxes, g), val));
+        [&](uint32_t g, const CType* values, int64_t length) {
+          CType min = GetSet::Get(raw_mins, g);
+          CType max = GetSet::Get(raw_maxes, g);
+          for (int64_t i = 0; i < length; ++i) {
+            min = std::min(min, values[i]);
+            max = std::max(max, values[i]);
+          }
+          GetSet::Set(raw_mins, g, min);
+          GetSet::Set(raw_maxes, g, max);
           bit_util::SetBit(has_values_.mutable_data(), g);
         },
         [&](uint32_t g) { bit_util::SetBit(has_nulls_.mutable_data(), g); });
@@ -1011,6 +1011,59 @@ TEST(GroupBy, MeanOnly) {
   }
 }
 
+TEST(GroupBy, SumMinMaxRuns) {
+  // Runs of group ids straddle blocks of values which are all valid, all null and mixed
+  constexpr int64_t kNumRows = 256;
+  constexpr int64_t kRunLength = 50;
+  constexpr int64_t kNumGroups = (kNumRows + kRunLength - 1) / kRunLength;
+
+  std::vector<int64_t> values(kNumRows), keys(kNumRows);
+  std::vector<bool> is_valid(kNumRows);
+  std::vector<int64_t> sums(kNumGroups, 0), mins(kNumGroups, kNumRows),
+      maxes(kNumGroups, -1), group_ids(kNumGroups);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    values[i] = i;
+    keys[i] = i / kRunLength;
+    is_valid[i] = i < 64 || (i < 128 && i % 3 != 0) || i >= 192;
+    if (is_valid[i]) {
+      sums[keys[i]] += i;
+      mins[keys[i]] = std::min(mins[keys[i]], i);
+      maxes[keys[i]] = std::max(maxes[keys[i]], i);
+    }
+  }
+  std::iota(group_ids.begin(), group_ids.end(), 0);
+
+  std::shared_ptr<Array> argument, key, expected_sums, expected_mins, expected_maxes,
+      expected_keys;
+  ArrayFromVector<Int64Type>(is_valid, values, &argument);
+  ArrayFromVector<Int64Type>(keys, &key);
+  ArrayFromVector<Int64Type>(sums, &expected_sums);
+  ArrayFromVector<Int64Type>(mins, &expected_mins);
+  ArrayFromVector<Int64Type>(maxes, &expected_maxes);
+  ArrayFromVector<Int64Type>(group_ids, &expected_keys);
+
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         internal::GroupBy({argument, argument}, {key},
+                                           {
+                                               {"hash_sum", nullptr},
+                                               {"hash_min_max", nullptr},
+                                           },
+                                           use_threads));
+    ValidateOutput(aggregated_and_grouped);
+    SortBy({"key_0"}, &aggregated_and_grouped);
+
+    const auto& out = *aggregated_and_grouped.array_as<StructArray>();
+    const auto& min_max = checked_cast<const StructArray&>(*out.field(1));
+    AssertArraysEqual(*expected_sums, *out.field(0), /*verbose=*/true);
+    AssertArraysEqual(*expected_mins, *min_max.field(0), /*verbose=*/true);
+    AssertArraysEqual(*expected_maxes, *min_max.field(1), /*verbose=*/true);
+    AssertArraysEqual(*expected_keys, *out.field(2), /*verbose=*/true);
+  }
+}
+
 TEST(GroupBy, SumMeanProductScalar) {
   BatchesWithSchema input;
   input.batches = {
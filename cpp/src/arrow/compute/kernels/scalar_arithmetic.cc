@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/macros.h"
@@ -149,6 +151,25 @@ struct AddChecked {
     return result;
   }
 
+  // Branch-free variants for ScalarBinaryCheckedIntegers: return the wrapped result
+  // and OR into *overflow a mask whose sign bit is set if the addition overflowed
+  template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+  static enable_if_signed_integer_value<T> CallWithOverflowMask(T left, T right,
+                                                                Unsigned* overflow) {
+    const T result = arrow::internal::SafeSignedAdd(left, right);
+    *overflow |= static_cast<Unsigned>((left ^ result) & (right ^ result));
+    return result;
+  }
+
+  template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+  static enable_if_unsigned_integer_value<T> CallWithOverflowMask(T left, T right,
+                                                                  Unsigned* overflow) {
+    const T result = static_cast<T>(left + right);
+    // The carry out of the most significant bit
+    *overflow |= static_cast<Unsigned>((left & right) | ((left | right) & ~result));
+    return result;
+  }
+
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
                                           Status*) {
@@ -202,6 +223,23 @@ struct SubtractChecked {
     return result;
   }
 
+  template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+  static enable_if_signed_integer_value<T> CallWithOverflowMask(T left, T right,
+                                                                Unsigned* overflow) {
+    const T result = arrow::internal::SafeSignedSubtract(left, right);
+    *overflow |= static_cast<Unsigned>((left ^ right) & (left ^ result));
+    return result;
+  }
+
+  template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+  static enable_if_unsigned_integer_value<T> CallWithOverflowMask(T left, T right,
+                                                                  Unsigned* overflow) {
+    const T result = static_cast<T>(left - right);
+    // The borrow out of the most significant bit
+    *overflow |= static_cast<Unsigned>((~left & right) | (~(left ^ right) & result));
+    return result;
+  }
+
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
                                           Status*) {
@@ -278,6 +316,30 @@ struct MultiplyChecked {
     return result;
   }
 
+  // Up to 32 bits, multiply in a type twice as wide (so that SIMD multiplies can be
+  // used) and check whether the product fits
+  template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+  static enable_if_t<std::is_integral<T>::value && (sizeof(T) < 8), T>
+  CallWithOverflowMask(T left, T right, Unsigned* overflow) {
+    using Wide = typename std::conditional<
+        sizeof(T) <= 2, typename std::conditional<std::is_signed<T>::value, int32_t,
+                                                  uint32_t>::type,
+        typename std::conditional<std::is_signed<T>::value, int64_t,
+                                  uint64_t>::type>::type;
+    const Wide product = static_cast<Wide>(left) * static_cast<Wide>(right);
+    const T result = static_cast<T>(product);
+    *overflow |= -static_cast<Unsigned>(product != static_cast<Wide>(result));
+    return result;
+  }
+
+  template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+  static enable_if_t<std::is_integral<T>::value && (sizeof(T) == 8), T>
+  CallWithOverflowMask(T left, T right, Unsigned* overflow) {
+    T result = 0;
+    *overflow |= -static_cast<Unsigned>(MultiplyWithOverflow(left, right, &result));
+    return result;
+  }
+
   template <typename T, typename Arg0, typename Arg1>
   static enable_if_floating_value<T> Call(KernelContext*, Arg0 left, Arg1 right,
                                           Status*) {
@@ -1472,6 +1534,101 @@ struct Trunc {
   }
 };
 
+// A kernel exec generator for the overflow-checked integer ops (AddChecked,
+// SubtractChecked, MultiplyChecked).
+//
+// Rather than testing and branching on every value, the wrapped results are computed
+// over the whole input along with an accumulated overflow mask, in a loop that the
+// compiler can vectorize. Null slots are computed too; only if the mask reports an
+// overflow are the non-null values revisited to decide whether to raise an error.
+//
+// This is plain C++ rather than xsimd, as xsimd is only available when building with
+// a SIMD level (ARROW_SIMD_LEVEL != NONE) while this kernel should be fast regardless.
+template <typename Type, typename Op>
+struct ScalarBinaryCheckedIntegers {
+  using T = typename Type::c_type;
+  using Unsigned = typename std::make_unsigned<T>::type;
+
+  struct Operand {
+    explicit Operand(const Datum& datum) {
+      if (datum.is_scalar()) {
+        scalar_value = UnboxScalar<Type>::Unbox(*datum.scalar());
+        values = &scalar_value;
+      } else {
+        const ArrayData& arr = *datum.array();
+        values = arr.GetValues<T>(1);
+        if (arr.MayHaveNulls()) {
+          validity = arr.buffers[0]->data();
+          offset = arr.offset;
+        }
+      }
+    }
+
+    bool IsValid(int64_t i) const {
+      return validity == NULLPTR || bit_util::GetBit(validity, offset + i);
+    }
+
+    T scalar_value = 0;
+    const T* values = NULLPTR;
+    const uint8_t* validity = NULLPTR;
+    int64_t offset = 0;
+  };
+
+  template <bool kLeftScalar, bool kRightScalar>
+  static bool ComputeAll(const T* left, const T* right, int64_t length, T* out) {
+    Unsigned overflow = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Op::template CallWithOverflowMask<T>(
+          left[kLeftScalar ? 0 : i], right[kRightScalar ? 0 : i], &overflow);
+    }
+    return (overflow >> (sizeof(T) * 8 - 1)) != 0;
+  }
+
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const bool left_is_scalar = batch[0].is_scalar();
+    const bool right_is_scalar = batch[1].is_scalar();
+    // Leave scalar and all-null outputs to the generic implementation
+    if ((left_is_scalar && right_is_scalar) ||
+        (left_is_scalar && !batch[0].scalar()->is_valid) ||
+        (right_is_scalar && !batch[1].scalar()->is_valid)) {
+      return ScalarBinaryNotNullEqualTypes<Type, Type, Op>::Exec(ctx, batch, out);
+    }
+    const Operand left(batch[0]), right(batch[1]);
+    ArrayData* out_arr = out->mutable_array();
+    T* out_values = out_arr->GetMutableValues<T>(1);
+    const int64_t length = out_arr->length;
+
+    bool overflow;
+    if (left_is_scalar) {
+      overflow = ComputeAll<true, false>(left.values, right.values, length, out_values);
+    } else if (right_is_scalar) {
+      overflow = ComputeAll<false, true>(left.values, right.values, length, out_values);
+    } else {
+      overflow = ComputeAll<false, false>(left.values, right.values, length, out_values);
+    }
+    if (ARROW_PREDICT_FALSE(overflow)) {
+      const int64_t left_step = left_is_scalar ? 0 : 1;
+      const int64_t right_step = right_is_scalar ? 0 : 1;
+      for (int64_t i = 0; i < length; ++i) {
+        if (!left.IsValid(i * left_step) || !right.IsValid(i * right_step)) continue;
+        Unsigned mask = 0;
+        Op::template CallWithOverflowMask<T>(left.values[i * left_step],
+                                             right.values[i * right_step], &mask);
+        if (mask >> (sizeof(T) * 8 - 1)) {
+          return Status::Invalid("overflow");
+        }
+      }
+    }
+    return Status::OK();
+  }
+};
+
+template <typename OutType, typename ArgType, typename Op>
+using ScalarBinaryChecked =
+    typename std::conditional<is_integer_type<ArgType>::value,
+                              ScalarBinaryCheckedIntegers<ArgType, Op>,
+                              ScalarBinaryNotNullEqualTypes<OutType, ArgType, Op>>::type;
+
 // Generate a kernel given an arithmetic functor
 template <template <typename... Args> class KernelGenerator, typename Op>
 ArrayKernelExec ArithmeticExecFromOp(detail::GetTypeId get_id) {
@@ -1623,6 +1780,112 @@ void AddDecimalUnaryKernels(ScalarFunction* func) {
   DCHECK_OK(func->AddKernel({in_type256}, out_type, exec256));
 }
 
+// Decimal128 ops on values of precision 18 or less, which fit in an int64 (see
+// ScalarBinaryDecimal128). Each writes the 128-bit result to out[2 * i].
+struct AddDecimal128Int64 {
+  static void Call(int64_t left, int64_t right, int64_t* out, int64_t i) {
+    // |left| and |right| are below 10**18, so their sum cannot overflow
+    PutDecimal128FromInt64(left + right, out, i);
+  }
+};
+
+struct SubtractDecimal128Int64 {
+  static void Call(int64_t left, int64_t right, int64_t* out, int64_t i) {
+    PutDecimal128FromInt64(left - right, out, i);
+  }
+};
+
+struct MultiplyDecimal128Int64 {
+  static void Call(int64_t left, int64_t right, int64_t* out, int64_t i) {
+    int64_t product;
+    if (ARROW_PREDICT_TRUE(!MultiplyWithOverflow(left, right, &product))) {
+      PutDecimal128FromInt64(product, out, i);
+    } else {
+      const Decimal128 wide_product = Decimal128(left) * Decimal128(right);
+      std::memcpy(out + 2 * i, wide_product.native_endian_bytes(), sizeof(Decimal128));
+    }
+  }
+};
+
+template <typename Op>
+struct Decimal128Int64Op {
+  using type = void;
+};
+
+template <>
+struct Decimal128Int64Op<Add> {
+  using type = AddDecimal128Int64;
+};
+template <>
+struct Decimal128Int64Op<AddChecked> {
+  using type = AddDecimal128Int64;
+};
+template <>
+struct Decimal128Int64Op<Subtract> {
+  using type = SubtractDecimal128Int64;
+};
+template <>
+struct Decimal128Int64Op<SubtractChecked> {
+  using type = SubtractDecimal128Int64;
+};
+template <>
+struct Decimal128Int64Op<Multiply> {
+  using type = MultiplyDecimal128Int64;
+};
+template <>
+struct Decimal128Int64Op<MultiplyChecked> {
+  using type = MultiplyDecimal128Int64;
+};
+
+// A kernel exec generator for binary Decimal128 ops. If the precision of both inputs
+// allows, the values are computed as int64 (promoting to 128 bits only where the
+// result requires it) instead of going through Decimal128 operations.
+template <typename Op, typename Int64Op = typename Decimal128Int64Op<Op>::type>
+struct ScalarBinaryDecimal128 {
+  template <bool kLeftScalar, bool kRightScalar>
+  static void ComputeAll(const Decimal128Int64Values& left,
+                         const Decimal128Int64Values& right, int64_t length,
+                         int64_t* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      Int64Op::Call(left.Get<kLeftScalar>(i), right.Get<kRightScalar>(i), out, i);
+    }
+  }
+
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const bool left_is_scalar = batch[0].is_scalar();
+    const bool right_is_scalar = batch[1].is_scalar();
+    if ((left_is_scalar && right_is_scalar) ||
+        (left_is_scalar && !batch[0].scalar()->is_valid) ||
+        (right_is_scalar && !batch[1].scalar()->is_valid) ||
+        !Decimal128FitsInInt64(*batch[0].type()) ||
+        !Decimal128FitsInInt64(*batch[1].type())) {
+      return ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec(
+          ctx, batch, out);
+    }
+    const Decimal128Int64Values left(batch[0]), right(batch[1]);
+    ArrayData* out_arr = out->mutable_array();
+    int64_t* out_words =
+        reinterpret_cast<int64_t*>(out_arr->buffers[1]->mutable_data()) +
+        2 * out_arr->offset;
+    if (left_is_scalar) {
+      ComputeAll<true, false>(left, right, out_arr->length, out_words);
+    } else if (right_is_scalar) {
+      ComputeAll<false, true>(left, right, out_arr->length, out_words);
+    } else {
+      ComputeAll<false, false>(left, right, out_arr->length, out_words);
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Op>
+struct ScalarBinaryDecimal128<Op, void> {
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    return ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec(
+        ctx, batch, out);
+  }
+};
+
 template <typename Op>
 void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
   OutputType out_type(null());
@@ -1639,7 +1902,7 @@ void AddDecimalBinaryKernels(const std::string& name, ScalarFunction* func) {
 
   auto in_type128 = InputType(Type::DECIMAL128);
   auto in_type256 = InputType(Type::DECIMAL256);
-  auto exec128 = ScalarBinaryNotNullEqualTypes<Decimal128Type, Decimal128Type, Op>::Exec;
+  auto exec128 = ScalarBinaryDecimal128<Op>::Exec;
   auto exec256 = ScalarBinaryNotNullEqualTypes<Decimal256Type, Decimal256Type, Op>::Exec;
   DCHECK_OK(func->AddKernel({in_type128, in_type128}, out_type, exec128));
   DCHECK_OK(func->AddKernel({in_type256, in_type256}, out_type, exec256));
@@ -1850,6 +2113,20 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionNotNull(std::string name,
   return func;
 }
 
+// Like MakeArithmeticFunctionNotNull, but for the overflow-checked ops that have a
+// branch-free integer implementation.
+template <typename Op>
+std::shared_ptr<ScalarFunction> MakeCheckedArithmeticFunction(std::string name,
+                                                              const FunctionDoc* doc) {
+  auto func = std::make_shared<ArithmeticFunction>(name, Arity::Binary(), doc);
+  for (const auto& ty : NumericTypes()) {
+    auto exec = ArithmeticExecFromOp<ScalarBinaryChecked, Op>(ty);
+    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+  }
+  AddNullExec(func.get());
+  return func;
+}
+
 template <typename Op>
 std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunction(std::string name,
                                                             const FunctionDoc* doc) {
@@ -2413,7 +2690,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
 
   // ----------------------------------------------------------------------
   auto add_checked =
-      MakeArithmeticFunctionNotNull<AddChecked>("add_checked", &add_checked_doc);
+      MakeCheckedArithmeticFunction<AddChecked>("add_checked", &add_checked_doc);
   AddDecimalBinaryKernels<AddChecked>("add_checked", add_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(add_checked)));
 
@@ -2431,7 +2708,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
 
   // ----------------------------------------------------------------------
-  auto subtract_checked = MakeArithmeticFunctionNotNull<SubtractChecked>(
+  auto subtract_checked = MakeCheckedArithmeticFunction<SubtractChecked>(
       "subtract_checked", &sub_checked_doc);
   AddDecimalBinaryKernels<SubtractChecked>("subtract_checked", subtract_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(subtract_checked)));
@@ -2442,7 +2719,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(multiply)));
 
   // ----------------------------------------------------------------------
-  auto multiply_checked = MakeArithmeticFunctionNotNull<MultiplyChecked>(
+  auto multiply_checked = MakeCheckedArithmeticFunction<MultiplyChecked>(
       "multiply_checked", &mul_checked_doc);
   AddDecimalBinaryKernels<MultiplyChecked>("multiply_checked", multiply_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply_checked)));
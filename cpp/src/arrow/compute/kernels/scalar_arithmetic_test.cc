@@ -697,6 +697,38 @@ TYPED_TEST(TestBinaryArithmeticIntegral, OverflowRaises) {
                           "overflow");
 }
 
+TYPED_TEST(TestBinaryArithmeticIntegral, OverflowRaisesOnlyOnNonNullValues) {
+  using CType = typename TestFixture::CType;
+  using BinaryFunction = typename TestFixture::BinaryFunction;
+
+  auto max = std::numeric_limits<CType>::max();
+
+  this->SetOverflowCheck(true);
+
+  // Longer, sliced inputs that overflow in every slot but only one of them is non-null
+  const int64_t length = 1000;
+  std::vector<bool> is_valid(length + 3, false);
+  is_valid[length] = true;
+  std::shared_ptr<Array> left, right;
+  ArrayFromVector<TypeParam, CType>(is_valid, std::vector<CType>(length + 3, max), &left);
+  ArrayFromVector<TypeParam, CType>(std::vector<CType>(length + 3, 2), &right);
+  left = left->Slice(3);
+  right = right->Slice(3);
+  auto all_null = TweakValidityBit(left, length - 3, false);
+  auto two = this->MakeScalar(CType(2));
+
+  for (BinaryFunction func : {BinaryFunction(Add), BinaryFunction(Multiply)}) {
+    ASSERT_RAISES(Invalid, func(left, right, this->options_, nullptr));
+    ASSERT_RAISES(Invalid, func(left, two, this->options_, nullptr));
+    ASSERT_RAISES(Invalid, func(two, left, this->options_, nullptr));
+
+    ASSERT_OK_AND_ASSIGN(Datum actual, func(all_null, right, this->options_, nullptr));
+    ASSERT_EQ(actual.array()->GetNullCount(), length);
+    ASSERT_OK(func(all_null, two, this->options_, nullptr));
+    ASSERT_OK(func(two, all_null, this->options_, nullptr));
+  }
+}
+
 TYPED_TEST(TestBinaryArithmeticSigned, AddOverflowRaises) {
   using CType = typename TestFixture::CType;
 
@@ -2713,6 +2745,43 @@ TEST_F(TestBinaryArithmeticDecimal, Multiply) {
   }
 }
 
+TEST_F(TestBinaryArithmeticDecimal, PrecisionFitsInInt64) {
+  // Inputs of precision 18 or less are computed as int64, with products promoted to
+  // 128 bits when they overflow
+  auto left = ArrayFromJSON(decimal128(18, 4), R"([
+      "99999999999999.9999", "-99999999999999.9999", "1.5000", "-0.0001", "0.0000",
+      "123456.7890", null
+    ])");
+  auto right = ArrayFromJSON(decimal128(18, 4), R"([
+      "99999999999999.9999", "99999999999999.9999", "-2.2500", "-0.0001", "1.0000",
+      "-98765.4321", "1.0000"
+    ])");
+  for (const auto& func : {"add", "add_checked"}) {
+    CheckScalarBinary(func, left, right, ArrayFromJSON(decimal128(19, 4), R"([
+        "199999999999999.9998", "0.0000", "-0.7500", "-0.0002", "1.0000",
+        "24691.3569", null
+      ])"));
+  }
+  for (const auto& func : {"subtract", "subtract_checked"}) {
+    CheckScalarBinary(func, left, right, ArrayFromJSON(decimal128(19, 4), R"([
+        "0.0000", "-199999999999999.9998", "3.7500", "0.0000", "-1.0000",
+        "222222.2211", null
+      ])"));
+  }
+  for (const auto& func : {"multiply", "multiply_checked"}) {
+    CheckScalarBinary(func, left, right, ArrayFromJSON(decimal128(37, 8), R"([
+        "9999999999999999980000000000.00000001",
+        "-9999999999999999980000000000.00000001", "-3.37500000", "0.00000001",
+        "0.00000000", "-12193263111.26352690", null
+      ])"));
+  }
+  CheckScalarBinary(
+      "multiply", ScalarFromJSON(decimal128(18, 0), R"("-999999999999999999")"),
+      ArrayFromJSON(decimal128(2, 0), R"(["99", "-99", "0"])"),
+      ArrayFromJSON(decimal128(21, 0),
+                    R"(["-98999999999999999901", "98999999999999999901", "0"])"));
+}
+
 TEST_F(TestBinaryArithmeticDecimal, Divide) {
   // array array, decimal128
   {
@@ -23,6 +23,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/int_util.h"
+#include "arrow/util/int_util_internal.h"
 #include "arrow/util/value_parsing.h"
 
 namespace arrow {
@@ -30,6 +31,7 @@ namespace arrow {
 using internal::BitBlockCount;
 using internal::CheckIntegersInRange;
 using internal::IntegersCanFit;
+using internal::MultiplyWithOverflow;
 using internal::OptionalBitBlockCounter;
 using internal::ParseValue;
 
@@ -508,6 +510,45 @@ struct SafeRescaleDecimal {
   int32_t out_scale_, out_precision_, in_scale_;
 };
 
+// Safely rescale a Decimal128 array whose input and output precisions are 18 or less
+// using int64 math. Returns false, leaving `out` to be overwritten, if some slot
+// (possibly a null one) cannot be rescaled exactly, so that the generic implementation
+// can report the error.
+static bool SafeRescaleDecimal128AsInt64(const ArrayData& in, int32_t in_scale,
+                                         int32_t out_scale, int32_t out_precision,
+                                         ArrayData* out) {
+  const int32_t delta = out_scale - in_scale;
+  if (delta > kMaxDecimal128PrecisionInInt64 ||
+      -delta > kMaxDecimal128PrecisionInInt64) {
+    return false;
+  }
+  int64_t factor = 1;
+  for (int32_t i = 0; i < std::abs(delta); ++i) factor *= 10;
+  int64_t bound = 1;
+  for (int32_t i = 0; i < out_precision; ++i) bound *= 10;
+
+  const Decimal128Int64Values values{Datum(in)};
+  int64_t* out_words =
+      reinterpret_cast<int64_t*>(out->buffers[1]->mutable_data()) + 2 * out->offset;
+  bool failed = false;
+  if (delta >= 0) {
+    for (int64_t i = 0; i < in.length; ++i) {
+      int64_t result;
+      failed |= MultiplyWithOverflow(values.Get(i), factor, &result);
+      failed |= (result >= bound) | (result <= -bound);
+      PutDecimal128FromInt64(result, out_words, i);
+    }
+  } else {
+    for (int64_t i = 0; i < in.length; ++i) {
+      const int64_t value = values.Get(i);
+      const int64_t result = value / factor;
+      failed |= (result * factor != value) | (result >= bound) | (result <= -bound);
+      PutDecimal128FromInt64(result, out_words, i);
+    }
+  }
+  return !failed;
+}
+
 template <typename O, typename I>
 struct CastFunctor<O, I,
                    enable_if_t<is_decimal_type<O>::value && is_decimal_type<I>::value>> {
@@ -534,6 +575,13 @@ struct CastFunctor<O, I,
     }
 
     // Safe rescale
+    if (std::is_same<O, Decimal128Type>::value &&
+        std::is_same<I, Decimal128Type>::value && batch[0].is_array() &&
+        Decimal128FitsInInt64(in_type) && Decimal128FitsInInt64(out_type) &&
+        SafeRescaleDecimal128AsInt64(*batch[0].array(), in_scale, out_scale,
+                                     out_type.precision(), out->mutable_array())) {
+      return Status::OK();
+    }
     applicator::ScalarUnaryNotNullStateful<O, I, SafeRescaleDecimal> kernel(
         SafeRescaleDecimal{out_scale, out_type.precision(), in_scale});
     return kernel.Exec(ctx, batch, out);
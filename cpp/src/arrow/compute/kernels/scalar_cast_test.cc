@@ -705,6 +705,24 @@ TEST(Cast, Decimal128ToDecimal128) {
   CheckCastFails(d_38_10, options);
   CheckCast(d_28_0, d_38_10_roundtripped, options);
 
+  // Rescale within the precisions whose values fit in an int64
+  auto d_18_2 = ArrayFromJSON(decimal128(18, 2), R"([
+      "-99999999999999.99",
+       "12345.67",
+      null])");
+  auto d_18_4 = ArrayFromJSON(decimal128(18, 4), R"([
+      "-99999999999999.9900",
+       "12345.6700",
+      null])");
+  CheckCast(d_18_2, d_18_4, options);
+  CheckCast(d_18_4, d_18_2, options);
+
+  options.to_type = d_18_2->type();
+  CheckCastFails(ArrayFromJSON(decimal128(18, 4), R"(["1.2345"])"), options);
+  options.to_type = d_18_4->type();
+  CheckCastFails(ArrayFromJSON(decimal128(18, 2), R"(["-9999999999999999.99"])"),
+                 options);
+
   // Precision loss without rescale leads to truncation
   auto d_4_2 = ArrayFromJSON(decimal128(4, 2), R"(["12.34"])");
   for (auto expected : {
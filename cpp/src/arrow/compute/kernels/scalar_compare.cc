@@ -21,7 +21,9 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/optional.h"
 
@@ -175,6 +177,46 @@ struct CompareTimestamps
   }
 };
 
+// Compare Decimal128 values as int64 when their precision allows
+template <typename Op>
+struct CompareDecimal128 {
+  using Base = applicator::ScalarBinaryEqualTypes<BooleanType, Decimal128Type, Op>;
+
+  template <bool kLeftScalar, bool kRightScalar>
+  static void CompareAll(KernelContext* ctx, const Decimal128Int64Values& left,
+                         const Decimal128Int64Values& right, ArrayData* out) {
+    int64_t i = 0;
+    ::arrow::internal::GenerateBitsUnrolled(
+        out->buffers[1]->mutable_data(), out->offset, out->length, [&]() -> bool {
+          const bool result = Op::template Call<bool, int64_t, int64_t>(
+              ctx, left.Get<kLeftScalar>(i), right.Get<kRightScalar>(i), nullptr);
+          ++i;
+          return result;
+        });
+  }
+
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const bool left_is_scalar = batch[0].is_scalar();
+    const bool right_is_scalar = batch[1].is_scalar();
+    if ((left_is_scalar && right_is_scalar) ||
+        (left_is_scalar && !batch[0].scalar()->is_valid) ||
+        (right_is_scalar && !batch[1].scalar()->is_valid) ||
+        !Decimal128FitsInInt64(*batch[0].type()) ||
+        !Decimal128FitsInInt64(*batch[1].type())) {
+      return Base::Exec(ctx, batch, out);
+    }
+    const Decimal128Int64Values left(batch[0]), right(batch[1]);
+    if (left_is_scalar) {
+      CompareAll<true, false>(ctx, left, right, out->mutable_array());
+    } else if (right_is_scalar) {
+      CompareAll<false, true>(ctx, left, right, out->mutable_array());
+    } else {
+      CompareAll<false, false>(ctx, left, right, out->mutable_array());
+    }
+    return Status::OK();
+  }
+};
+
 template <typename Op>
 void AddIntegerCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
   auto exec =
@@ -295,10 +337,14 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
-  for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
-    auto exec = GenerateDecimal<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(id);
-    DCHECK_OK(
-        func->AddKernel({InputType(id), InputType(id)}, boolean(), std::move(exec)));
+  {
+    auto ty = InputType(Type::DECIMAL128);
+    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), CompareDecimal128<Op>::Exec));
+  }
+  {
+    auto exec = applicator::ScalarBinaryEqualTypes<BooleanType, Decimal256Type, Op>::Exec;
+    auto ty = InputType(Type::DECIMAL256);
+    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
   {
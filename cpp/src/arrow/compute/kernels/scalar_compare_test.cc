@@ -621,6 +621,30 @@ TYPED_TEST(TestCompareDecimal, DifferentParameters) {
   }
 }
 
+TYPED_TEST(TestCompareDecimal, LargeValues) {
+  // Around the largest precision whose values fit in an int64
+  std::vector<std::pair<std::string, std::string>> cases = {
+      {"equal", "[0, 0, 0, 1, null]"},   {"not_equal", "[1, 1, 1, 0, null]"},
+      {"less", "[0, 1, 1, 0, null]"},    {"less_equal", "[0, 1, 1, 1, null]"},
+      {"greater", "[1, 0, 0, 0, null]"}, {"greater_equal", "[1, 0, 0, 1, null]"},
+  };
+
+  for (int32_t precision : {18, 19}) {
+    auto ty = std::make_shared<TypeParam>(precision, 4);
+    auto lhs = ArrayFromJSON(
+        ty, R"(["99999999999999.9999", "-99999999999999.9999", "-0.0001", "0", null])");
+    auto rhs = ArrayFromJSON(
+        ty, R"(["-99999999999999.9999", "99999999999999.9999", "0", "-0", "1"])");
+    for (const auto& op : cases) {
+      const auto& function = op.first;
+      const auto& expected = op.second;
+
+      SCOPED_TRACE(function);
+      CheckScalarBinary(function, lhs, rhs, ArrayFromJSON(boolean(), expected));
+    }
+  }
+}
+
 // Helper to organize tests for fixed size binary comparisons
 struct CompareCase {
   std::shared_ptr<DataType> lhs_type;
@@ -0,0 +1,237 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/exec/key_encode.h"
+#include "arrow/compute/exec/key_hash.h"
+#include "arrow/compute/exec/util.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+using KeyColumnArray = KeyEncoder::KeyColumnArray;
+using KeyColumnMetadata = KeyEncoder::KeyColumnMetadata;
+
+// Number of rows hashed at a time.  Hashing::HashMultiColumn keeps its temporaries
+// on a TempVectorStack and indexes null rows with 16-bit ids.
+constexpr int64_t kHashMiniBatchLength = 1 << 10;
+
+Result<KeyColumnMetadata> ColumnMetadataFromType(const DataType& type) {
+  if (type.id() == Type::BOOL) {
+    return KeyColumnMetadata(true, 0);
+  } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    return KeyColumnMetadata(false, sizeof(uint32_t));
+  } else if (type.id() != Type::NA && type.id() != Type::DICTIONARY &&
+             is_fixed_width(type.id())) {
+    const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+    if (byte_width > 0) {
+      return KeyColumnMetadata(true, byte_width);
+    }
+  }
+  return Status::NotImplemented("Hashing values of type ", type);
+}
+
+KeyColumnArray ColumnArrayFromArrayData(const KeyColumnMetadata& metadata,
+                                        const ArrayData& data) {
+  const uint8_t* validity = data.buffers[0] ? data.buffers[0]->data() : nullptr;
+  const uint8_t* var_length = nullptr;
+  if (!metadata.is_fixed_length && data.buffers[2]) {
+    var_length = data.buffers[2]->data();
+  }
+  KeyColumnArray base(metadata, data.offset + data.length, validity,
+                      data.buffers[1]->data(), var_length);
+  return KeyColumnArray(base, data.offset, data.length);
+}
+
+// Hashing::HashMultiColumn loads keys by whole 8-byte words and 16-byte stripes, so
+// it may read up to this many bytes past the end of a key.  Bitmaps (validity, and
+// the values of booleans) are read by whole 8-byte words too.  This is fine for the
+// padded buffers used by the group by, but not for arbitrary (e.g. imported) buffers.
+constexpr int64_t kHashReadPastEnd = 16;
+constexpr int64_t kBitmapReadPastEnd = 8;
+
+const uint8_t* BufferEnd(const ArrayData& data, int i) {
+  const auto& buffer = data.buffers[i];
+  return buffer ? buffer->data() + buffer->size() : nullptr;
+}
+
+// Copies of the buffers of a column, see PadColumnIfNeeded
+struct ColumnScratch {
+  std::vector<uint8_t> validity;
+  std::vector<uint8_t> values;
+  std::vector<uint32_t> offsets;
+};
+
+// Return `bits`, or a copy of the bytes holding `num_bits` bits from `bit_offset`
+// into `scratch` if reading them by words could go past `bits_end`.
+const uint8_t* PadBitmapIfNeeded(const uint8_t* bits, int bit_offset, int64_t num_bits,
+                                 const uint8_t* bits_end, std::vector<uint8_t>* scratch) {
+  if (bits == nullptr) {
+    return bits;
+  }
+  const int64_t num_bytes = ::arrow::bit_util::BytesForBits(bit_offset + num_bits);
+  if (bits_end - (bits + num_bytes) >= kBitmapReadPastEnd) {
+    return bits;
+  }
+  scratch->assign(num_bytes + kBitmapReadPastEnd, 0);
+  std::memcpy(scratch->data(), bits, num_bytes);
+  return scratch->data();
+}
+
+// Return `column`, a minibatch of `data`, with any of its buffers that hashing
+// could read past the end of replaced by padded copies in `scratch`.
+KeyColumnArray PadColumnIfNeeded(const KeyColumnArray& column, const ArrayData& data,
+                                 ColumnScratch* scratch) {
+  const KeyColumnMetadata& metadata = column.metadata();
+  const int64_t length = column.length();
+  const uint8_t* validity =
+      PadBitmapIfNeeded(column.data(0), column.bit_offset(0), length,
+                        BufferEnd(data, 0), &scratch->validity);
+
+  if (metadata.is_fixed_length) {
+    const uint32_t width = metadata.fixed_length;
+    const uint8_t* values = column.data(1);
+    if (width == 0) {
+      // Booleans are unpacked to bytes a bitmap word at a time
+      values = PadBitmapIfNeeded(values, column.bit_offset(1), length,
+                                 BufferEnd(data, 1), &scratch->values);
+    } else if (width != 1 && width != 2 && width != 4 && width != 8) {
+      // Keys of 1, 2, 4 or 8 bytes are loaded one at a time
+      const int64_t num_bytes = length * width;
+      if (BufferEnd(data, 1) - (values + num_bytes) < kHashReadPastEnd) {
+        scratch->values.assign(num_bytes + kHashReadPastEnd, 0);
+        std::memcpy(scratch->values.data(), values, num_bytes);
+        values = scratch->values.data();
+      }
+    }
+    return KeyColumnArray(metadata, length, validity, values, /*buffer2=*/nullptr,
+                          column.bit_offset(0), column.bit_offset(1));
+  }
+
+  const uint32_t* offsets = column.offsets();
+  const uint8_t* values = column.data(2);
+  if (values == nullptr ||
+      BufferEnd(data, 2) - (values + offsets[length]) >= kHashReadPastEnd) {
+    return KeyColumnArray(metadata, length, validity, column.data(1), values,
+                          column.bit_offset(0));
+  }
+  const uint32_t num_bytes = offsets[length] - offsets[0];
+  scratch->values.assign(num_bytes + kHashReadPastEnd, 0);
+  std::memcpy(scratch->values.data(), values + offsets[0], num_bytes);
+  scratch->offsets.resize(length + 1);
+  for (int64_t i = 0; i <= length; ++i) {
+    scratch->offsets[i] = offsets[i] - offsets[0];
+  }
+  return KeyColumnArray(metadata, length, validity,
+                        reinterpret_cast<const uint8_t*>(scratch->offsets.data()),
+                        scratch->values.data(), column.bit_offset(0));
+}
+
+Status Hash32Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const int64_t num_rows = batch.length;
+  const int num_columns = batch.num_values();
+
+  // Scalars are broadcast, so that a scalar hashes the same as an array of
+  // the same values
+  std::vector<KeyColumnMetadata> metadata(num_columns);
+  std::vector<std::shared_ptr<ArrayData>> arrays(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    ARROW_ASSIGN_OR_RAISE(metadata[i], ColumnMetadataFromType(*batch[i].type()));
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*batch[i].scalar(), num_rows,
+                                                            ctx->memory_pool()));
+      arrays[i] = array->data();
+    } else {
+      arrays[i] = batch[i].array();
+    }
+  }
+
+  uint32_t scalar_hash = 0;
+  uint32_t* hashes = &scalar_hash;
+  if (out->is_array()) {
+    hashes = out->mutable_array()->GetMutableValues<uint32_t>(1);
+  }
+
+  if (num_rows > 0) {
+    util::TempVectorStack stack;
+    RETURN_NOT_OK(stack.Init(ctx->memory_pool(), 64 * kHashMiniBatchLength));
+    KeyEncoder::KeyEncoderContext encode_ctx;
+    encode_ctx.hardware_flags = ctx->exec_context()->cpu_info()->hardware_flags();
+    encode_ctx.stack = &stack;
+
+    std::vector<KeyColumnArray> columns(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      columns[i] = ColumnArrayFromArrayData(metadata[i], *arrays[i]);
+    }
+    std::vector<KeyColumnArray> minibatch(num_columns);
+    std::vector<ColumnScratch> scratch(num_columns);
+    for (int64_t start = 0; start < num_rows; start += kHashMiniBatchLength) {
+      const int64_t length = std::min(kHashMiniBatchLength, num_rows - start);
+      for (int i = 0; i < num_columns; ++i) {
+        minibatch[i] = PadColumnIfNeeded(KeyColumnArray(columns[i], start, length),
+                                         *arrays[i], &scratch[i]);
+      }
+      Hashing::HashMultiColumn(minibatch, &encode_ctx, hashes + start);
+    }
+  }
+
+  if (out->is_scalar()) {
+    auto out_scalar = checked_cast<UInt32Scalar*>(out->scalar().get());
+    out_scalar->value = scalar_hash;
+    out_scalar->is_valid = true;
+  }
+  return Status::OK();
+}
+
+const FunctionDoc hash_32_doc{
+    "Compute a 32-bit hash of each row",
+    ("A hash is computed for each row over the values of all arguments, using the\n"
+     "same xxHash-based hashing as the group by implementation.\n"
+     "Null values all hash the same within a column, and the output is never\n"
+     "null.  Hashes only depend on the values of a row and not on how the\n"
+     "input is sliced or chunked, nor on the CPU features available, and are\n"
+     "stable across releases.\n"
+     "Supported argument types are boolean, fixed-width types, binary and string."),
+    {"*args"}};
+
+}  // namespace
+
+void RegisterScalarHash(FunctionRegistry* registry) {
+  auto hash_32 =
+      std::make_shared<ScalarFunction>("hash_32", Arity::VarArgs(1), &hash_32_doc);
+  ScalarKernel kernel{KernelSignature::Make({InputType{}}, uint32(),
+                                            /*is_varargs=*/true),
+                      Hash32Exec};
+  kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  kernel.mem_allocation = MemAllocation::PREALLOCATE;
+  DCHECK_OK(hash_32->AddKernel(std::move(kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(hash_32)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
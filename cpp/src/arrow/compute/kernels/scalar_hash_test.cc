@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+
+TEST(TestHash32, StableValues) {
+  // These values must not change, since users may persist them
+  // (e.g. for partitioning data)
+  CheckScalar("hash_32", {ArrayFromJSON(int32(), "[0, 1, 2, null]")},
+              ArrayFromJSON(uint32(), "[0, 1034859202, 2052875653, 0]"));
+  CheckScalar("hash_32", {ArrayFromJSON(utf8(), R"(["", "a", "arrow", null])")},
+              ArrayFromJSON(uint32(), "[3296170055, 2158799001, 3150892997, 0]"));
+  CheckScalar(
+      "hash_32",
+      {ArrayFromJSON(utf8(), R"(["longer than sixteen bytes", "0123456789abcdef"])")},
+      ArrayFromJSON(uint32(), "[445426338, 1281708104]"));
+  CheckScalar("hash_32",
+              {ArrayFromJSON(fixed_size_binary(3), R"(["abc", "xyz", null, "abc"])")},
+              ArrayFromJSON(uint32(), "[1543508116, 822440521, 0, 1543508116]"));
+  CheckScalar("hash_32", {ArrayFromJSON(boolean(), "[true, false, true, null]")},
+              ArrayFromJSON(uint32(), "[3935239151, 0, 3935239151, 0]"));
+
+  CheckScalar("hash_32",
+              {ArrayFromJSON(int32(), "[0, 1, 2, null]"),
+               ArrayFromJSON(utf8(), R"(["", "a", "arrow", null])"),
+               ArrayFromJSON(boolean(), "[true, false, true, null]")},
+              ArrayFromJSON(uint32(), "[798732840, 2142089289, 1426269460, 3449077726]"));
+}
+
+TEST(TestHash32, Nulls) {
+  // Nulls hash the same whatever the value behind them
+  auto values = ArrayFromJSON(int64(), "[1, 2, 3]");
+  auto masked = values->data()->Copy();
+  auto validity = ArrayFromJSON(boolean(), "[false, true, false]");
+  masked->buffers[0] = validity->data()->buffers[1];
+  masked->null_count = kUnknownNullCount;
+  ASSERT_OK_AND_ASSIGN(Datum hashes, CallFunction("hash_32", {masked}));
+  ASSERT_EQ(hashes.make_array()->null_count(), 0);
+  CheckScalar("hash_32", {ArrayFromJSON(int64(), "[null, 2, null]")}, hashes);
+}
+
+TEST(TestHash32, SlicedAndChunked) {
+  random::RandomArrayGenerator rng(kRandomSeed);
+  const int64_t length = 5000;
+  for (const auto& ty : {int8(), int32(), float64(), boolean(), utf8(), binary(),
+                         fixed_size_binary(5), decimal128(20, 4)}) {
+    ARROW_SCOPED_TRACE("type = ", ty->ToString());
+    auto first = rng.ArrayOf(ty, length, /*null_probability=*/0.1);
+    auto second = rng.ArrayOf(utf8(), length, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(Datum hashes, CallFunction("hash_32", {first, second}));
+    ValidateOutput(hashes);
+    auto expected = hashes.make_array();
+
+    for (int64_t offset : {1, 13, 1024, 2047}) {
+      ASSERT_OK_AND_ASSIGN(
+          Datum sliced_hashes,
+          CallFunction("hash_32", {first->Slice(offset), second->Slice(offset)}));
+      AssertArraysEqual(*expected->Slice(offset), *sliced_hashes.make_array());
+    }
+
+    auto chunked_first = std::make_shared<ChunkedArray>(
+        ArrayVector{first->Slice(0, 100), first->Slice(100)});
+    auto chunked_second = std::make_shared<ChunkedArray>(
+        ArrayVector{second->Slice(0, 3000), second->Slice(3000)});
+    ASSERT_OK_AND_ASSIGN(Datum chunked_hashes,
+                         CallFunction("hash_32", {chunked_first, chunked_second}));
+    AssertDatumsEqual(std::make_shared<ChunkedArray>(expected), chunked_hashes);
+  }
+}
+
+TEST(TestHash32, UnpaddedBuffers) {
+  // Values may live in buffers that end right after the last value (e.g. buffers
+  // imported through the C data interface), which must not be read past
+  random::RandomArrayGenerator rng(kRandomSeed);
+  auto check_unpadded = [](const std::shared_ptr<Array>& values, int buffer_index,
+                           int64_t size) {
+    std::vector<uint8_t> unpadded(values->data()->buffers[buffer_index]->data(),
+                                  values->data()->buffers[buffer_index]->data() + size);
+    auto data = values->data()->Copy();
+    data->buffers[buffer_index] = Buffer::Wrap(unpadded);
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("hash_32", {values}));
+    CheckScalar("hash_32", {MakeArray(data)}, expected);
+  };
+  for (int32_t byte_width : {3, 5, 7, 9, 13, 15, 17, 23}) {
+    ARROW_SCOPED_TRACE("byte_width = ", byte_width);
+    const int64_t length = 1030;
+    auto values = rng.FixedSizeBinary(length, byte_width, /*null_probability=*/0.1);
+    check_unpadded(values, 1, length * byte_width);
+  }
+  auto values = rng.String(1030, 0, 40, /*null_probability=*/0.1);
+  const auto& strings = checked_cast<const StringArray&>(*values);
+  check_unpadded(values, 2, strings.total_values_length());
+
+  // Bitmaps are read by words too: the last minibatch of 6 rows ends in the last
+  // byte of a 129-byte bitmap
+  const int64_t bitmap_size = bit_util::BytesForBits(1030);
+  check_unpadded(rng.Int32(1030, 0, 100, /*null_probability=*/0.1), 0, bitmap_size);
+  auto booleans = rng.Boolean(1030, /*true_probability=*/0.5, /*null_probability=*/0.1);
+  check_unpadded(booleans, 0, bitmap_size);
+  check_unpadded(booleans, 1, bitmap_size);
+  check_unpadded(booleans->Slice(3), 1, bitmap_size);
+}
+
+TEST(TestHash32, Scalars) {
+  // Scalars hash like arrays of repeated values
+  auto values = ArrayFromJSON(utf8(), R"(["x", "y", null])");
+  for (const auto& scalar_and_array : std::vector<std::pair<std::string, std::string>>{
+           {"7", "[7, 7, 7]"}, {"null", "[null, null, null]"}}) {
+    ASSERT_OK_AND_ASSIGN(
+        Datum expected,
+        CallFunction("hash_32",
+                     {ArrayFromJSON(int32(), scalar_and_array.second), values}));
+    CheckScalar("hash_32", {ScalarFromJSON(int32(), scalar_and_array.first), values},
+                expected);
+  }
+}
+
+TEST(TestHash32, Errors) {
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("Hashing values of type large_string"),
+      CallFunction("hash_32", {ArrayFromJSON(large_utf8(), R"(["a"])")}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("Hashing values of type list<item: int32>"),
+      CallFunction("hash_32", {ArrayFromJSON(list(int32()), "[[1]]")}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("needs at least 1 arguments"),
+      CallFunction("hash_32", {}));
+}
+
+}  // namespace compute
+}  // namespace arrow
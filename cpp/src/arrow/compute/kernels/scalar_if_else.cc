@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+#include <limits>
+
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/builder_time.h"
@@ -644,65 +647,37 @@ struct IfElseFunctor<Type, enable_if_base_binary<Type>> {
     const auto* right_offsets = right.GetValues<OffsetType>(1);
     const uint8_t* right_data = right.buffers[2]->data();
 
-    // allocate data buffer conservatively
-    int64_t data_buff_alloc = left_offsets[left.length] - left_offsets[0] +
-                              right_offsets[right.length] - right_offsets[0];
-
-    BuilderType builder(ctx->memory_pool());
-    ARROW_RETURN_NOT_OK(builder.Reserve(cond.length + 1));
-    ARROW_RETURN_NOT_OK(builder.ReserveData(data_buff_alloc));
-
-    RunLoop(
-        cond, *out,
+    return WriteOutput(
+        ctx, cond,
         [&](int64_t i) {
-          builder.UnsafeAppend(left_data + left_offsets[i],
-                               left_offsets[i + 1] - left_offsets[i]);
+          return util::string_view(
+              reinterpret_cast<const char*>(left_data + left_offsets[i]),
+              left_offsets[i + 1] - left_offsets[i]);
         },
         [&](int64_t i) {
-          builder.UnsafeAppend(right_data + right_offsets[i],
-                               right_offsets[i + 1] - right_offsets[i]);
+          return util::string_view(
+              reinterpret_cast<const char*>(right_data + right_offsets[i]),
+              right_offsets[i + 1] - right_offsets[i]);
         },
-        [&]() { builder.UnsafeAppendNull(); });
-    ARROW_ASSIGN_OR_RAISE(auto out_arr, builder.Finish());
-
-    out->SetNullCount(out_arr->data()->null_count);
-    out->buffers[0] = std::move(out_arr->data()->buffers[0]);
-    out->buffers[1] = std::move(out_arr->data()->buffers[1]);
-    out->buffers[2] = std::move(out_arr->data()->buffers[2]);
-    return Status::OK();
+        out);
   }
 
   // ASA
   static Status Call(KernelContext* ctx, const ArrayData& cond, const Scalar& left,
                      const ArrayData& right, ArrayData* out) {
     util::string_view left_data = internal::UnboxScalar<Type>::Unbox(left);
-    auto left_size = static_cast<OffsetType>(left_data.size());
 
     const auto* right_offsets = right.GetValues<OffsetType>(1);
     const uint8_t* right_data = right.buffers[2]->data();
 
-    // allocate data buffer conservatively
-    int64_t data_buff_alloc =
-        left_size * cond.length + right_offsets[right.length] - right_offsets[0];
-
-    BuilderType builder(ctx->memory_pool());
-    ARROW_RETURN_NOT_OK(builder.Reserve(cond.length + 1));
-    ARROW_RETURN_NOT_OK(builder.ReserveData(data_buff_alloc));
-
-    RunLoop(
-        cond, *out, [&](int64_t i) { builder.UnsafeAppend(left_data.data(), left_size); },
+    return WriteOutput(
+        ctx, cond, [&](int64_t i) { return left_data; },
         [&](int64_t i) {
-          builder.UnsafeAppend(right_data + right_offsets[i],
-                               right_offsets[i + 1] - right_offsets[i]);
+          return util::string_view(
+              reinterpret_cast<const char*>(right_data + right_offsets[i]),
+              right_offsets[i + 1] - right_offsets[i]);
         },
-        [&]() { builder.UnsafeAppendNull(); });
-    ARROW_ASSIGN_OR_RAISE(auto out_arr, builder.Finish());
-
-    out->SetNullCount(out_arr->data()->null_count);
-    out->buffers[0] = std::move(out_arr->data()->buffers[0]);
-    out->buffers[1] = std::move(out_arr->data()->buffers[1]);
-    out->buffers[2] = std::move(out_arr->data()->buffers[2]);
-    return Status::OK();
+        out);
   }
 
   // AAS
@@ -712,58 +687,65 @@ struct IfElseFunctor<Type, enable_if_base_binary<Type>> {
     const uint8_t* left_data = left.buffers[2]->data();
 
     util::string_view right_data = internal::UnboxScalar<Type>::Unbox(right);
-    auto right_size = static_cast<OffsetType>(right_data.size());
 
-    // allocate data buffer conservatively
-    int64_t data_buff_alloc =
-        right_size * cond.length + left_offsets[left.length] - left_offsets[0];
-
-    BuilderType builder(ctx->memory_pool());
-    ARROW_RETURN_NOT_OK(builder.Reserve(cond.length + 1));
-    ARROW_RETURN_NOT_OK(builder.ReserveData(data_buff_alloc));
-
-    RunLoop(
-        cond, *out,
+    return WriteOutput(
+        ctx, cond,
         [&](int64_t i) {
-          builder.UnsafeAppend(left_data + left_offsets[i],
-                               left_offsets[i + 1] - left_offsets[i]);
+          return util::string_view(
+              reinterpret_cast<const char*>(left_data + left_offsets[i]),
+              left_offsets[i + 1] - left_offsets[i]);
         },
-        [&](int64_t i) { builder.UnsafeAppend(right_data.data(), right_size); },
-        [&]() { builder.UnsafeAppendNull(); });
-    ARROW_ASSIGN_OR_RAISE(auto out_arr, builder.Finish());
-
-    out->SetNullCount(out_arr->data()->null_count);
-    out->buffers[0] = std::move(out_arr->data()->buffers[0]);
-    out->buffers[1] = std::move(out_arr->data()->buffers[1]);
-    out->buffers[2] = std::move(out_arr->data()->buffers[2]);
-    return Status::OK();
+        [&](int64_t i) { return right_data; }, out);
   }
 
   // ASS
   static Status Call(KernelContext* ctx, const ArrayData& cond, const Scalar& left,
                      const Scalar& right, ArrayData* out) {
     util::string_view left_data = internal::UnboxScalar<Type>::Unbox(left);
-    auto left_size = static_cast<OffsetType>(left_data.size());
-
     util::string_view right_data = internal::UnboxScalar<Type>::Unbox(right);
-    auto right_size = static_cast<OffsetType>(right_data.size());
 
-    // allocate data buffer conservatively
-    int64_t data_buff_alloc = std::max(right_size, left_size) * cond.length;
-    BuilderType builder(ctx->memory_pool());
-    ARROW_RETURN_NOT_OK(builder.Reserve(cond.length + 1));
-    ARROW_RETURN_NOT_OK(builder.ReserveData(data_buff_alloc));
+    return WriteOutput(
+        ctx, cond, [&](int64_t i) { return left_data; },
+        [&](int64_t i) { return right_data; }, out);
+  }
 
+  // Write the selected values into output buffers allocated once at their exact
+  // size: a first pass sums the lengths of the selected values, a second one
+  // copies them.  The output validity was already computed by the caller.
+  template <typename GetLeft, typename GetRight>
+  static Status WriteOutput(KernelContext* ctx, const ArrayData& cond,
+                            GetLeft&& get_left, GetRight&& get_right, ArrayData* out) {
+    int64_t data_length = 0;
     RunLoop(
-        cond, *out, [&](int64_t i) { builder.UnsafeAppend(left_data.data(), left_size); },
-        [&](int64_t i) { builder.UnsafeAppend(right_data.data(), right_size); },
-        [&]() { builder.UnsafeAppendNull(); });
-    ARROW_ASSIGN_OR_RAISE(auto out_arr, builder.Finish());
-
-    out->SetNullCount(out_arr->data()->null_count);
-    out->buffers[0] = std::move(out_arr->data()->buffers[0]);
-    out->buffers[1] = std::move(out_arr->data()->buffers[1]);
-    out->buffers[2] = std::move(out_arr->data()->buffers[2]);
+        cond, *out, [&](int64_t i) { data_length += get_left(i).size(); },
+        [&](int64_t i) { data_length += get_right(i).size(); }, [&]() {});
+    if (ARROW_PREDICT_FALSE(data_length > std::numeric_limits<OffsetType>::max())) {
+      return Status::CapacityError("array cannot contain more than ",
+                                   std::numeric_limits<OffsetType>::max(),
+                                   " bytes, have ", data_length);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(out->buffers[1],
+                          ctx->Allocate((cond.length + 1) * sizeof(OffsetType)));
+    ARROW_ASSIGN_OR_RAISE(out->buffers[2], ctx->Allocate(data_length));
+    auto* out_offsets = out->GetMutableValues<OffsetType>(1);
+    uint8_t* out_data = out->buffers[2]->mutable_data();
+
+    OffsetType offset = 0;
+    *out_offsets++ = offset;
+    auto append = [&](util::string_view value) {
+      // Avoid memcpy with a null pointer for empty values
+      if (!value.empty()) {
+        std::memcpy(out_data + offset, value.data(), value.size());
+      }
+      offset += static_cast<OffsetType>(value.size());
+      *out_offsets++ = offset;
+    };
+    RunLoop(
+        cond, *out, [&](int64_t i) { append(get_left(i)); },
+        [&](int64_t i) { append(get_right(i)); }, [&]() { *out_offsets++ = offset; });
+
+    out->SetNullCount(out->buffers[0] ? kUnknownNullCount : 0);
     return Status::OK();
   }
 
@@ -1691,6 +1673,25 @@ Status ExecVarWidthScalarCaseWhen(KernelContext* ctx, const ExecBatch& batch,
   return Status::OK();
 }
 
+// Return the index of the argument selected by the conditions for the given row,
+// or -1 if no condition is true and there is no 'else' argument
+static int64_t SelectCaseWhenArgument(const ExecBatch& batch,
+                                      const ArrayData& conds_array, bool have_else_arg,
+                                      int64_t row) {
+  for (int64_t arg = 0; static_cast<size_t>(arg) < conds_array.child_data.size();
+       arg++) {
+    const ArrayData& cond_array = *conds_array.child_data[arg];
+    if ((!cond_array.buffers[0] ||
+         bit_util::GetBit(cond_array.buffers[0]->data(),
+                          conds_array.offset + cond_array.offset + row)) &&
+        bit_util::GetBit(cond_array.buffers[1]->data(),
+                         conds_array.offset + cond_array.offset + row)) {
+      return arg + 1;
+    }
+  }
+  return have_else_arg ? static_cast<int64_t>(batch.values.size() - 1) : -1;
+}
+
 // Use std::function for reserve_data to avoid instantiating template so much
 template <typename AppendScalar>
 static Status ExecVarWidthArrayCaseWhenImpl(
@@ -1706,19 +1707,8 @@ static Status ExecVarWidthArrayCaseWhenImpl(
   RETURN_NOT_OK(reserve_data(raw_builder.get()));
 
   for (int64_t row = 0; row < batch.length; row++) {
-    int64_t selected = have_else_arg ? static_cast<int64_t>(batch.values.size() - 1) : -1;
-    for (int64_t arg = 0; static_cast<size_t>(arg) < conds_array.child_data.size();
-         arg++) {
-      const ArrayData& cond_array = *conds_array.child_data[arg];
-      if ((!cond_array.buffers[0] ||
-           bit_util::GetBit(cond_array.buffers[0]->data(),
-                            conds_array.offset + cond_array.offset + row)) &&
-          bit_util::GetBit(cond_array.buffers[1]->data(),
-                           conds_array.offset + cond_array.offset + row)) {
-        selected = arg + 1;
-        break;
-      }
-    }
+    const int64_t selected =
+        SelectCaseWhenArgument(batch, conds_array, have_else_arg, row);
     if (selected < 0) {
       RETURN_NOT_OK(raw_builder->AppendNull());
       continue;
@@ -1772,37 +1762,86 @@ struct CaseWhenFunctor<Type, enable_if_base_binary<Type>> {
     return ExecArray(ctx, batch, out);
   }
 
+  // Write the selected values into output buffers allocated once at their exact
+  // size: a first pass sums the lengths of the selected values, a second one
+  // copies them and computes the validity bitmap.
   static Status ExecArray(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    return ExecVarWidthArrayCaseWhenImpl(
-        ctx, batch, out,
-        // ReserveData
-        [&](ArrayBuilder* raw_builder) {
-          int64_t reservation = 0;
-          for (size_t arg = 1; arg < batch.values.size(); arg++) {
-            auto source = batch.values[arg];
-            if (source.is_scalar()) {
-              const auto& scalar =
-                  checked_cast<const BaseBinaryScalar&>(*source.scalar());
-              if (!scalar.value) continue;
-              reservation =
-                  std::max<int64_t>(reservation, batch.length * scalar.value->size());
-            } else {
-              const auto& array = *source.array();
-              const auto& offsets = array.GetValues<offset_type>(1);
-              reservation =
-                  std::max<int64_t>(reservation, offsets[array.length] - offsets[0]);
-            }
-          }
-          // checked_cast works since (Large)StringBuilder <: (Large)BinaryBuilder
-          return checked_cast<BuilderType*>(raw_builder)->ReserveData(reservation);
-        },
-        // AppendScalar
-        [](ArrayBuilder* raw_builder, const Scalar& raw_scalar) {
-          const auto& scalar = checked_cast<const BaseBinaryScalar&>(raw_scalar);
-          return checked_cast<BuilderType*>(raw_builder)
-              ->Append(scalar.value->data(),
-                       static_cast<offset_type>(scalar.value->size()));
-        });
+    const auto& conds_array = *batch.values[0].array();
+    ArrayData* output = out->mutable_array();
+    const bool have_else_arg =
+        static_cast<size_t>(conds_array.type->num_fields()) < (batch.values.size() - 1);
+
+    int64_t data_length = 0;
+    for (int64_t row = 0; row < batch.length; row++) {
+      util::string_view value;
+      if (GetSelectedValue(batch, conds_array, have_else_arg, row, &value)) {
+        data_length += value.size();
+      }
+    }
+    if (ARROW_PREDICT_FALSE(data_length > std::numeric_limits<offset_type>::max())) {
+      return Status::CapacityError("array cannot contain more than ",
+                                   std::numeric_limits<offset_type>::max(),
+                                   " bytes, have ", data_length);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(output->buffers[0], ctx->AllocateBitmap(batch.length));
+    ARROW_ASSIGN_OR_RAISE(output->buffers[1],
+                          ctx->Allocate((batch.length + 1) * sizeof(offset_type)));
+    ARROW_ASSIGN_OR_RAISE(output->buffers[2], ctx->Allocate(data_length));
+    uint8_t* out_valid = output->buffers[0]->mutable_data();
+    auto* out_offsets = output->GetMutableValues<offset_type>(1);
+    uint8_t* out_data = output->buffers[2]->mutable_data();
+
+    int64_t null_count = 0;
+    offset_type offset = 0;
+    out_offsets[0] = 0;
+    for (int64_t row = 0; row < batch.length; row++) {
+      util::string_view value;
+      if (GetSelectedValue(batch, conds_array, have_else_arg, row, &value)) {
+        bit_util::SetBit(out_valid, row);
+        if (!value.empty()) {
+          std::memcpy(out_data + offset, value.data(), value.size());
+        }
+        offset += static_cast<offset_type>(value.size());
+      } else {
+        bit_util::ClearBit(out_valid, row);
+        ++null_count;
+      }
+      out_offsets[row + 1] = offset;
+    }
+    if (null_count == 0) {
+      output->buffers[0] = nullptr;
+    }
+    output->length = batch.length;
+    output->offset = 0;
+    output->null_count = null_count;
+    return Status::OK();
+  }
+
+  // Return false if the output is null for the given row, otherwise set `value`
+  static bool GetSelectedValue(const ExecBatch& batch, const ArrayData& conds_array,
+                               bool have_else_arg, int64_t row,
+                               util::string_view* value) {
+    const int64_t selected =
+        SelectCaseWhenArgument(batch, conds_array, have_else_arg, row);
+    if (selected < 0) return false;
+    const Datum& source = batch.values[selected];
+    if (source.is_scalar()) {
+      const auto& scalar = checked_cast<const BaseBinaryScalar&>(*source.scalar());
+      if (!scalar.is_valid) return false;
+      *value = util::string_view(*scalar.value);
+      return true;
+    }
+    const ArrayData& array = *source.array();
+    if (array.buffers[0] &&
+        !bit_util::GetBit(array.buffers[0]->data(), array.offset + row)) {
+      return false;
+    }
+    const offset_type* offsets = array.GetValues<offset_type>(1);
+    const uint8_t* data = array.GetValues<uint8_t>(2, /*absolute_offset=*/0);
+    *value = util::string_view(reinterpret_cast<const char*>(data + offsets[row]),
+                               offsets[row + 1] - offsets[row]);
+    return true;
   }
 };
 
@@ -1582,6 +1582,14 @@ TYPED_TEST(TestCaseWhenBinary, Basics) {
               ArrayFromJSON(type, R"(["cDE", null, null, "efg"])"));
   CheckScalar("case_when", {MakeStruct({cond1, cond2}), values_null, values2, values1},
               ArrayFromJSON(type, R"([null, null, null, "efg"])"));
+
+  // Sliced inputs and empty strings
+  auto values3 = ArrayFromJSON(type, R"(["", "xyz", "", "uv", ""])")->Slice(1);
+  auto scalar_empty = ScalarFromJSON(type, R"("")");
+  CheckScalar("case_when", {MakeStruct({cond2}), values3, scalar2},
+              ArrayFromJSON(type, R"(["xyz", "b", "uv", "b"])"));
+  CheckScalar("case_when", {MakeStruct({cond2}), values3, scalar_empty},
+              ArrayFromJSON(type, R"(["xyz", "", "uv", ""])"));
 }
 
 template <typename Type>
@@ -15,6 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
@@ -22,6 +27,7 @@
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/hashing.h"
 #include "arrow/visitor_inline.h"
@@ -35,6 +41,139 @@ namespace compute {
 namespace internal {
 namespace {
 
+// Direct-indexed lookup tables, used instead of the hash table when an integer
+// value set spans a small range (e.g. status codes or enum ids).  The generic
+// version is never enabled.
+template <typename Type, typename Enable = void>
+struct DenseSetLookup {
+  template <typename MemoTable>
+  void Init(const MemoTable&, const std::vector<int32_t>&) {}
+
+  bool enabled() const { return false; }
+
+  void ExecIsIn(const ArrayData&, bool, ArrayData*) const {}
+
+  void ExecIndexIn(const ArrayData&, int32_t, Int32Builder*) const {}
+};
+
+template <typename Type>
+struct DenseSetLookup<Type, enable_if_unsigned_integer<Type>> {
+  using T = typename Type::c_type;
+  using SignedT = typename std::make_signed<T>::type;
+
+  // A value set is looked up directly if its range is at most
+  // max(kMaxRange, kMaxRangePerValue * number of distinct values)
+  static constexpr uint64_t kMaxRange = 1 << 12;
+  static constexpr uint64_t kMaxRangePerValue = 8;
+
+  template <typename MemoTable>
+  void Init(const MemoTable& lookup_table,
+            const std::vector<int32_t>& memo_index_to_value_index) {
+    const int32_t memo_size = lookup_table.size();
+    const int32_t memo_null = lookup_table.GetNull();
+    const int32_t num_values = memo_size - (memo_null >= 0);
+    if (num_values == 0) {
+      return;
+    }
+    std::vector<T> values(memo_size);
+    lookup_table.CopyValues(values.data());
+
+    // The physical type is unsigned, but the logical type may be signed: pick
+    // whichever interpretation gives the tighter range.  Keys are computed with
+    // wrapping subtraction, so the same code works for both.
+    T umin = std::numeric_limits<T>::max(), umax = std::numeric_limits<T>::min();
+    SignedT smin = std::numeric_limits<SignedT>::max();
+    SignedT smax = std::numeric_limits<SignedT>::min();
+    for (int32_t i = 0; i < memo_size; ++i) {
+      if (i == memo_null) continue;
+      umin = std::min(umin, values[i]);
+      umax = std::max(umax, values[i]);
+      smin = std::min(smin, static_cast<SignedT>(values[i]));
+      smax = std::max(smax, static_cast<SignedT>(values[i]));
+    }
+    const T uspan = static_cast<T>(umax - umin);
+    const T sspan = static_cast<T>(static_cast<T>(smax) - static_cast<T>(smin));
+    base_ = uspan <= sspan ? umin : static_cast<T>(smin);
+    span_ = std::min(uspan, sspan);
+
+    const uint64_t max_range = std::max(
+        uint64_t{kMaxRange}, kMaxRangePerValue * static_cast<uint64_t>(num_values));
+    if (static_cast<uint64_t>(span_) >= max_range) {
+      return;
+    }
+    // One extra, always absent, slot past the end lets probes clamp out-of-range
+    // keys instead of branching on them
+    const int64_t num_slots = static_cast<int64_t>(span_) + 2;
+    index_.assign(num_slots, -1);
+    bitmap_.assign(bit_util::BytesForBits(num_slots), 0);
+    for (int32_t i = 0; i < memo_size; ++i) {
+      if (i == memo_null) continue;
+      const T key = static_cast<T>(values[i] - base_);
+      index_[key] = memo_index_to_value_index[i];
+      bit_util::SetBit(bitmap_.data(), key);
+    }
+  }
+
+  bool enabled() const { return !index_.empty(); }
+
+  // The clamp is done in 64 bits, as span_ + 1 wraps around in T when the
+  // value set covers the whole range of T
+  uint64_t Key(T v) const {
+    return std::min(static_cast<uint64_t>(static_cast<T>(v - base_)),
+                    static_cast<uint64_t>(span_) + 1);
+  }
+
+  void ExecIsIn(const ArrayData& data, bool null_matches, ArrayData* out) const {
+    const T* values = data.GetValues<T>(1);
+    const uint8_t* bitmap = bitmap_.data();
+    uint8_t* out_bitmap = out->buffers[1]->mutable_data();
+    int64_t i = 0;
+    if (data.GetNullCount() == 0) {
+      ::arrow::internal::GenerateBitsUnrolled(out_bitmap, out->offset, out->length, [&] {
+        return bit_util::GetBit(bitmap, Key(values[i++]));
+      });
+    } else {
+      const uint8_t* validity = data.buffers[0]->data();
+      ::arrow::internal::GenerateBitsUnrolled(out_bitmap, out->offset, out->length, [&] {
+        const bool result = bit_util::GetBit(validity, data.offset + i)
+                                ? bit_util::GetBit(bitmap, Key(values[i]))
+                                : null_matches;
+        ++i;
+        return result;
+      });
+    }
+  }
+
+  void ExecIndexIn(const ArrayData& data, int32_t null_index,
+                   Int32Builder* builder) const {
+    const int32_t* index = index_.data();
+    VisitArrayDataInline<Type>(
+        data,
+        [&](T v) {
+          const int32_t value_index = index[Key(v)];
+          if (value_index != -1) {
+            builder->UnsafeAppend(value_index);
+          } else {
+            builder->UnsafeAppendNull();
+          }
+        },
+        [&]() {
+          if (null_index != -1) {
+            builder->UnsafeAppend(null_index);
+          } else {
+            builder->UnsafeAppendNull();
+          }
+        });
+  }
+
+  T base_ = 0;
+  T span_ = 0;
+  // (value - base) -> index in value_set, or -1
+  std::vector<int32_t> index_;
+  // Bit (value - base) is set if the value is in value_set
+  std::vector<uint8_t> bitmap_;
+};
+
 template <typename Type>
 struct SetLookupState : public KernelState {
   explicit SetLookupState(MemoryPool* pool) : lookup_table(pool, 0) {}
@@ -58,6 +197,7 @@ struct SetLookupState : public KernelState {
     if (!options.skip_nulls && lookup_table.GetNull() >= 0) {
       null_index = memo_index_to_value_index[lookup_table.GetNull()];
     }
+    dense_lookup.Init(lookup_table, memo_index_to_value_index);
     return Status::OK();
   }
 
@@ -99,6 +239,7 @@ struct SetLookupState : public KernelState {
   // be mapped back to indices in the value_set.
   std::vector<int32_t> memo_index_to_value_index;
   int32_t null_index = -1;
+  DenseSetLookup<Type> dense_lookup;
 };
 
 template <>
@@ -258,6 +399,10 @@ struct IndexInVisitor {
     const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
 
     RETURN_NOT_OK(this->builder.Reserve(data.length));
+    if (state.dense_lookup.enabled()) {
+      state.dense_lookup.ExecIndexIn(data, state.null_index, &this->builder);
+      return Status::OK();
+    }
     VisitArrayDataInline<Type>(
         data,
         [&](T v) {
@@ -353,6 +498,11 @@ struct IsInVisitor {
     const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
     ArrayData* output = out->mutable_array();
 
+    if (state.dense_lookup.enabled()) {
+      state.dense_lookup.ExecIsIn(this->data, state.null_index != -1, output);
+      return Status::OK();
+    }
+
     FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(), output->offset,
                                  output->length);
 
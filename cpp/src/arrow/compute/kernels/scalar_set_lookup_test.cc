@@ -20,8 +20,10 @@
 #include <cstdio>
 #include <functional>
 #include <iosfwd>
+#include <limits>
 #include <locale>
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -434,6 +436,14 @@ TEST_F(TestIsInKernel, DictionaryArray) {
   }
 }
 
+TEST_F(TestIsInKernel, ValueSetSpanningWholeType) {
+  // The value sets are looked up directly, with one slot per value of the type
+  CheckIsIn(int8(), "[-128, -127, -2, -1, 0, 1, 126, 127, null]", "[-128, -1, 0, 127]",
+            "[true, false, false, true, true, false, false, true, false]");
+  CheckIsIn(uint8(), "[0, 1, 128, 254, 255, null]", "[255, 0, 128]",
+            "[true, false, true, false, true, false]");
+}
+
 TEST_F(TestIsInKernel, ChunkedArrayInvoke) {
   auto input = ChunkedArrayFromJSON(
       utf8(), {R"(["abc", "def", "", "abc", "jkl"])", R"(["def", null, "abc", "zzz"])"});
@@ -1026,6 +1036,14 @@ TEST_F(TestIndexInKernel, DictionaryArray) {
   }
 }
 
+TEST_F(TestIndexInKernel, ValueSetSpanningWholeType) {
+  // The value sets are looked up directly, with one slot per value of the type
+  this->CheckIndexIn(int8(), "[-128, -127, -2, -1, 0, 1, 126, 127, null]",
+                     "[-128, -1, 0, 127]", "[0, null, null, 1, 2, null, null, 3, null]");
+  this->CheckIndexIn(uint8(), "[0, 1, 128, 254, 255, null]", "[255, 0, 128]",
+                     "[1, null, 2, null, 0, null]");
+}
+
 TEST_F(TestIndexInKernel, ChunkedArrayInvoke) {
   auto input = ChunkedArrayFromJSON(utf8(), {R"(["abc", "def", "ghi", "abc", "jkl"])",
                                              R"(["def", null, "abc", "zzz"])"});
@@ -1053,6 +1071,84 @@ TEST_F(TestIndexInKernel, ChunkedArrayInvoke) {
   CheckIndexInChunked(input, value_set, expected, /*skip_nulls=*/true);
 }
 
+template <typename Type>
+class TestSetLookupIntegers : public ::testing::Test {};
+
+TYPED_TEST_SUITE(TestSetLookupIntegers, IntegralArrowTypes);
+
+TYPED_TEST(TestSetLookupIntegers, DenseAndSparseValueSets) {
+  // Value sets spanning a small range are looked up directly rather than
+  // hashed; check both kinds against a reference, around the edges of the
+  // value set and of the type's domain
+  using CType = typename TypeParam::c_type;
+  using Limits = std::numeric_limits<CType>;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  std::default_random_engine gen(42);
+
+  auto make_array = [&](const std::vector<CType>& values, bool with_null) {
+    NumericBuilder<TypeParam> builder;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (with_null && i % 7 == 3) {
+        ARROW_EXPECT_OK(builder.AppendNull());
+      }
+      ARROW_EXPECT_OK(builder.Append(values[i]));
+    }
+    return builder.Finish().ValueOrDie();
+  };
+
+  const CType lo = Limits::is_signed ? static_cast<CType>(-25) : 10;
+  std::vector<std::vector<CType>> value_sets;
+  // Dense range, with duplicates
+  value_sets.emplace_back();
+  for (int i = 0; i < 60; ++i) {
+    value_sets.back().push_back(static_cast<CType>(lo + (i * 7) % 50));
+  }
+  // Sparse for wide types, dense for 8-bit ones
+  value_sets.push_back({Limits::min(), static_cast<CType>(Limits::min() + 1), 0, 1,
+                        static_cast<CType>(Limits::max() - 1), Limits::max()});
+
+  for (const auto& value_set_values : value_sets) {
+    for (bool skip_nulls : {false, true}) {
+      auto value_set = make_array(value_set_values, /*with_null=*/true);
+      std::vector<CType> input_values;
+      for (int i = 0; i < 300; ++i) {
+        const auto& v = value_set_values[gen() % value_set_values.size()];
+        input_values.push_back(static_cast<CType>(v + static_cast<CType>(gen() % 5) - 2));
+      }
+      auto input = make_array(input_values, /*with_null=*/true);
+
+      BooleanBuilder expected_is_in;
+      Int32Builder expected_index_in;
+      const auto& value_set_data =
+          checked_cast<const NumericArray<TypeParam>&>(*value_set);
+      const auto& input_data = checked_cast<const NumericArray<TypeParam>&>(*input);
+      for (int64_t i = 0; i < input->length(); ++i) {
+        int32_t found = -1;
+        for (int64_t j = 0; j < value_set->length() && found == -1; ++j) {
+          if (input->IsNull(i) ? (value_set->IsNull(j) && !skip_nulls)
+                               : (value_set->IsValid(j) &&
+                                  value_set_data.Value(j) == input_data.Value(i))) {
+            found = static_cast<int32_t>(j);
+          }
+        }
+        ASSERT_OK(expected_is_in.Append(found != -1));
+        ASSERT_OK(found != -1 ? expected_index_in.Append(found)
+                              : expected_index_in.AppendNull());
+      }
+
+      SetLookupOptions options(value_set, skip_nulls);
+      ASSERT_OK_AND_ASSIGN(Datum is_in, IsIn(input, options));
+      ValidateOutput(is_in);
+      AssertArraysEqual(*expected_is_in.Finish().ValueOrDie(), *is_in.make_array(),
+                        /*verbose=*/true);
+      ASSERT_OK_AND_ASSIGN(Datum index_in, IndexIn(input->Slice(1), options));
+      ValidateOutput(index_in);
+      AssertArraysEqual(*expected_index_in.Finish().ValueOrDie()->Slice(1),
+                        *index_in.make_array(), /*verbose=*/true);
+    }
+  }
+}
+
 TEST(TestSetLookup, DispatchBest) {
   for (std::string name : {"is_in", "index_in"}) {
     CheckDispatchBest(name, {int32()}, {int32()});
@@ -16,8 +16,11 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <string>
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -26,15 +29,19 @@
 
 #ifdef ARROW_WITH_RE2
 #include <re2/re2.h>
+#include <re2/set.h>
 #endif
 
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_nested.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
 #include "arrow/util/value_parsing.h"
@@ -925,16 +932,30 @@ struct StringTransformCodepoint : public FunctionalCaseMappingTransform {
   int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
                     uint8_t* output) {
     uint8_t* output_start = output;
-    if (ARROW_PREDICT_FALSE(
-            !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
-                                        CodepointTransform::TransformCodepoint))) {
-      return kTransformError;
+    const uint8_t* end = input + input_string_ncodeunits;
+    while (input < end) {
+      if (*input < 0x80) {
+        // Map a whole run of ASCII characters without decoding them
+        const int64_t ascii_length = arrow::util::AsciiPrefixLength(input, end - input);
+        output = std::transform(input, input + ascii_length, output,
+                                CodepointTransform::TransformAscii);
+        input += ascii_length;
+      } else {
+        uint32_t codepoint = 0;
+        if (ARROW_PREDICT_FALSE(!arrow::util::UTF8Decode(&input, &codepoint))) {
+          return kTransformError;
+        }
+        output = arrow::util::UTF8Encode(
+            output, CodepointTransform::TransformCodepoint(codepoint));
+      }
     }
     return output - output_start;
   }
 };
 
 struct UTF8UpperTransform : public FunctionalCaseMappingTransform {
+  static uint8_t TransformAscii(uint8_t c) { return ascii_toupper(c); }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
@@ -945,6 +966,8 @@ template <typename Type>
 using UTF8Upper = StringTransformExec<Type, StringTransformCodepoint<UTF8UpperTransform>>;
 
 struct UTF8LowerTransform : public FunctionalCaseMappingTransform {
+  static uint8_t TransformAscii(uint8_t c) { return ascii_tolower(c); }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
@@ -955,6 +978,8 @@ template <typename Type>
 using UTF8Lower = StringTransformExec<Type, StringTransformCodepoint<UTF8LowerTransform>>;
 
 struct UTF8SwapCaseTransform : public FunctionalCaseMappingTransform {
+  static uint8_t TransformAscii(uint8_t c) { return ascii_swapcase(c); }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     if (codepoint <= kMaxCodepointLookup) {
       return lut_swapcase_codepoint[codepoint];
@@ -1689,6 +1714,411 @@ void AddMatchSubstring(FunctionRegistry* registry) {
 #endif
 }
 
+// Multi-pattern substring matching
+
+// An Aho-Corasick automaton over bytes, compiled into a dense DFA so that each
+// input byte costs a single table lookup.  Bytes that don't occur in any pattern
+// share one equivalence class, which keeps the transition table narrow.
+class AhoCorasickAutomaton {
+ public:
+  static constexpr int32_t kNoMatch = std::numeric_limits<int32_t>::max();
+
+  explicit AhoCorasickAutomaton(const std::vector<std::string>& patterns) {
+    byte_classes_.fill(0);
+    num_classes_ = 1;
+    for (const auto& pattern : patterns) {
+      for (const char c : pattern) {
+        auto& byte_class = byte_classes_[static_cast<uint8_t>(c)];
+        if (byte_class == 0) {
+          byte_class = static_cast<uint16_t>(num_classes_++);
+        }
+      }
+    }
+
+    // Build the trie of patterns
+    std::vector<std::pair<int32_t, int32_t>> terminals;  // (state, pattern id)
+    AddState();
+    for (size_t i = 0; i < patterns.size(); ++i) {
+      int32_t state = 0;
+      for (const char c : patterns[i]) {
+        const int64_t index = TransitionIndex(state, static_cast<uint8_t>(c));
+        if (transitions_[index] < 0) {
+          const int32_t next = AddState();
+          transitions_[index] = next;
+        }
+        state = transitions_[index];
+      }
+      terminals.emplace_back(state, static_cast<int32_t>(i));
+    }
+    const auto num_states = static_cast<int32_t>(transitions_.size() / num_classes_);
+
+    min_output_.assign(num_states, kNoMatch);
+    output_offsets_.assign(num_states + 1, 0);
+    for (const auto& terminal : terminals) {
+      int32_t& min_output = min_output_[terminal.first];
+      min_output = std::min(min_output, terminal.second);
+      ++output_offsets_[terminal.first + 1];
+    }
+    for (int32_t state = 0; state < num_states; ++state) {
+      output_offsets_[state + 1] += output_offsets_[state];
+    }
+    outputs_.resize(terminals.size());
+    {
+      std::vector<int32_t> cursor(output_offsets_.begin(), output_offsets_.end() - 1);
+      for (const auto& terminal : terminals) {
+        outputs_[cursor[terminal.first]++] = terminal.second;
+      }
+    }
+
+    // Compute failure links breadth-first and turn the trie into a DFA.  The root's
+    // own outputs (empty patterns) are reported separately, so `report_` chains
+    // never include the root.
+    fail_.assign(num_states, 0);
+    report_.assign(num_states, -1);
+    std::vector<int32_t> queue;
+    queue.reserve(num_states);
+    for (int32_t c = 0; c < num_classes_; ++c) {
+      int32_t& next = transitions_[c];
+      if (next < 0) {
+        next = 0;
+      } else {
+        queue.push_back(next);
+      }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+      const int32_t state = queue[head];
+      const int32_t fail = fail_[state];
+      report_[state] = HasOwnOutputs(state) ? state : report_[fail];
+      min_output_[state] = std::min(min_output_[state], min_output_[fail]);
+      int32_t* row = &transitions_[static_cast<int64_t>(state) * num_classes_];
+      const int32_t* fail_row = &transitions_[static_cast<int64_t>(fail) * num_classes_];
+      for (int32_t c = 0; c < num_classes_; ++c) {
+        if (row[c] < 0) {
+          row[c] = fail_row[c];
+        } else {
+          fail_[row[c]] = fail_row[c];
+          queue.push_back(row[c]);
+        }
+      }
+    }
+  }
+
+  bool empty() const { return outputs_.empty(); }
+
+  /// Return the smallest id of a pattern occurring in `s`, or kNoMatch
+  int32_t FindFirst(util::string_view s) const {
+    int32_t best = min_output_[0];
+    int32_t state = 0;
+    for (const char c : s) {
+      if (best == 0) break;
+      state = transitions_[TransitionIndex(state, static_cast<uint8_t>(c))];
+      best = std::min(best, min_output_[state]);
+    }
+    return best;
+  }
+
+  /// Call `visit(id)` for each occurrence of a pattern in `s`
+  template <typename Visit>
+  void FindAll(util::string_view s, Visit&& visit) const {
+    VisitOwnOutputs(0, visit);
+    int32_t state = 0;
+    for (const char c : s) {
+      state = transitions_[TransitionIndex(state, static_cast<uint8_t>(c))];
+      for (int32_t out = report_[state]; out >= 0; out = report_[fail_[out]]) {
+        VisitOwnOutputs(out, visit);
+      }
+    }
+  }
+
+ private:
+  int32_t AddState() {
+    const auto state = static_cast<int32_t>(transitions_.size() / num_classes_);
+    transitions_.resize(transitions_.size() + num_classes_, -1);
+    return state;
+  }
+
+  int64_t TransitionIndex(int32_t state, uint8_t byte) const {
+    return static_cast<int64_t>(state) * num_classes_ + byte_classes_[byte];
+  }
+
+  bool HasOwnOutputs(int32_t state) const {
+    return output_offsets_[state + 1] > output_offsets_[state];
+  }
+
+  template <typename Visit>
+  void VisitOwnOutputs(int32_t state, Visit&& visit) const {
+    for (int32_t i = output_offsets_[state]; i < output_offsets_[state + 1]; ++i) {
+      visit(outputs_[i]);
+    }
+  }
+
+  std::array<uint16_t, 256> byte_classes_;
+  int32_t num_classes_;
+  // Dense (state, byte class) -> state table
+  std::vector<int32_t> transitions_;
+  std::vector<int32_t> fail_;
+  // Nearest non-root state along the failure chain (including the state itself)
+  // that terminates a pattern, or -1
+  std::vector<int32_t> report_;
+  // Smallest id of any pattern that is a suffix of the state's prefix
+  std::vector<int32_t> min_output_;
+  // Pattern ids terminating at each state, in CSR layout
+  std::vector<int32_t> output_offsets_;
+  std::vector<int32_t> outputs_;
+};
+
+constexpr int32_t AhoCorasickAutomaton::kNoMatch;
+
+// Compiled form of MatchSubstringSetOptions, built once per kernel invocation.
+// Literal patterns are matched by an Aho-Corasick automaton and regular expressions
+// by a single RE2::Set, so each input value is scanned at most twice regardless of
+// the number of patterns.
+class MatchSubstringSetState : public KernelState {
+ public:
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    auto options = static_cast<const MatchSubstringSetOptions*>(args.options);
+    if (options == nullptr) {
+      return Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions");
+    }
+    const bool is_utf8 = args.inputs[0].type->id() == Type::STRING ||
+                         args.inputs[0].type->id() == Type::LARGE_STRING;
+    std::unique_ptr<MatchSubstringSetState> state(
+        new MatchSubstringSetState(*options));
+    RETURN_NOT_OK(state->Compile(*options, is_utf8));
+    return std::move(state);
+  }
+
+  int32_t num_patterns() const { return num_patterns_; }
+
+  /// Return the smallest id of a pattern matching `s`, or -1
+  int32_t MatchFirst(util::string_view s, std::vector<int>* scratch) const {
+    int32_t best = literals_.FindFirst(s);
+    if (best != AhoCorasickAutomaton::kNoMatch) {
+      // Literal ids always precede regex ids
+      return best;
+    }
+#ifdef ARROW_WITH_RE2
+    if (regexes_ && regexes_->Match(ToStringPiece(s), scratch)) {
+      for (const int i : *scratch) {
+        best = std::min(best, regex_ids_[i]);
+      }
+    }
+#endif
+    return best == AhoCorasickAutomaton::kNoMatch ? -1 : best;
+  }
+
+  /// Store the sorted ids of all patterns matching `s` into `ids`
+  void MatchAll(util::string_view s, std::vector<int32_t>* ids, std::vector<bool>* seen,
+                std::vector<int>* scratch) const {
+    ids->clear();
+    literals_.FindAll(s, [&](int32_t id) {
+      if (!(*seen)[id]) {
+        (*seen)[id] = true;
+        ids->push_back(id);
+      }
+    });
+    for (const int32_t id : *ids) {
+      (*seen)[id] = false;
+    }
+#ifdef ARROW_WITH_RE2
+    if (regexes_ && regexes_->Match(ToStringPiece(s), scratch)) {
+      for (const int i : *scratch) {
+        ids->push_back(regex_ids_[i]);
+      }
+    }
+#endif
+    std::sort(ids->begin(), ids->end());
+  }
+
+ private:
+  explicit MatchSubstringSetState(const MatchSubstringSetOptions& options)
+      : num_patterns_(static_cast<int32_t>(options.patterns.size() +
+                                           options.regex_patterns.size())),
+        literals_(options.ignore_case ? std::vector<std::string>{} : options.patterns) {}
+
+  Status Compile(const MatchSubstringSetOptions& options, bool is_utf8) {
+#ifdef ARROW_WITH_RE2
+    const auto num_literals = static_cast<int32_t>(options.patterns.size());
+    std::vector<std::pair<std::string, int32_t>> regexes;
+    if (options.ignore_case) {
+      for (int32_t i = 0; i < num_literals; ++i) {
+        regexes.emplace_back(RE2::QuoteMeta(options.patterns[i]), i);
+      }
+    }
+    for (size_t i = 0; i < options.regex_patterns.size(); ++i) {
+      regexes.emplace_back(options.regex_patterns[i],
+                           num_literals + static_cast<int32_t>(i));
+    }
+    if (regexes.empty()) {
+      return Status::OK();
+    }
+    regexes_.reset(new RE2::Set(MakeRE2Options(is_utf8, options.ignore_case),
+                                RE2::UNANCHORED));
+    for (const auto& regex : regexes) {
+      std::string error;
+      if (regexes_->Add(ToStringPiece(regex.first), &error) < 0) {
+        return Status::Invalid("Invalid regular expression: ", error);
+      }
+      regex_ids_.push_back(regex.second);
+    }
+    if (!regexes_->Compile()) {
+      return Status::OutOfMemory("Could not compile regular expression set");
+    }
+    return Status::OK();
+#else
+    if (options.ignore_case) {
+      return Status::NotImplemented("ignore_case requires RE2");
+    }
+    if (!options.regex_patterns.empty()) {
+      return Status::NotImplemented("regex_patterns require RE2");
+    }
+    return Status::OK();
+#endif
+  }
+
+  int32_t num_patterns_;
+  AhoCorasickAutomaton literals_;
+#ifdef ARROW_WITH_RE2
+  std::unique_ptr<RE2::Set> regexes_;
+  // Pattern id of each regex in `regexes_`
+  std::vector<int32_t> regex_ids_;
+#endif
+};
+
+template <typename Type>
+struct MatchSubstringSetFirst {
+  using ScalarType = typename TypeTraits<Type>::ScalarType;
+
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& state = checked_cast<const MatchSubstringSetState&>(*ctx->state());
+    std::vector<int> scratch;
+    if (batch[0].kind() == Datum::ARRAY) {
+      const ArrayData& input = *batch[0].array();
+      Int32Builder builder(ctx->memory_pool());
+      RETURN_NOT_OK(builder.Reserve(input.length));
+      VisitArrayDataInline<Type>(
+          input,
+          [&](util::string_view s) {
+            const int32_t id = state.MatchFirst(s, &scratch);
+            if (id >= 0) {
+              builder.UnsafeAppend(id);
+            } else {
+              builder.UnsafeAppendNull();
+            }
+          },
+          [&]() { builder.UnsafeAppendNull(); });
+      std::shared_ptr<Array> out_array;
+      RETURN_NOT_OK(builder.Finish(&out_array));
+      *out = std::move(out_array);
+    } else {
+      const auto& input = checked_cast<const ScalarType&>(*batch[0].scalar());
+      int32_t id = -1;
+      if (input.is_valid) {
+        id = state.MatchFirst(util::string_view(*input.value), &scratch);
+      }
+      out->value = id >= 0 ? std::make_shared<Int32Scalar>(id) : MakeNullScalar(int32());
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+struct MatchSubstringSetAll {
+  using ScalarType = typename TypeTraits<Type>::ScalarType;
+
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& state = checked_cast<const MatchSubstringSetState&>(*ctx->state());
+    std::vector<int32_t> ids;
+    std::vector<bool> seen(state.num_patterns(), false);
+    std::vector<int> scratch;
+    if (batch[0].kind() == Datum::ARRAY) {
+      const ArrayData& input = *batch[0].array();
+      auto value_builder = std::make_shared<Int32Builder>(ctx->memory_pool());
+      ListBuilder builder(ctx->memory_pool(), value_builder);
+      RETURN_NOT_OK(builder.Reserve(input.length));
+      RETURN_NOT_OK(VisitArrayDataInline<Type>(
+          input,
+          [&](util::string_view s) {
+            state.MatchAll(s, &ids, &seen, &scratch);
+            RETURN_NOT_OK(builder.Append());
+            return value_builder->AppendValues(ids.data(),
+                                               static_cast<int64_t>(ids.size()));
+          },
+          [&]() { return builder.AppendNull(); }));
+      std::shared_ptr<Array> out_array;
+      RETURN_NOT_OK(builder.Finish(&out_array));
+      *out = std::move(out_array);
+    } else {
+      const auto& input = checked_cast<const ScalarType&>(*batch[0].scalar());
+      if (input.is_valid) {
+        state.MatchAll(util::string_view(*input.value), &ids, &seen, &scratch);
+        Int32Builder value_builder(ctx->memory_pool());
+        RETURN_NOT_OK(
+            value_builder.AppendValues(ids.data(), static_cast<int64_t>(ids.size())));
+        std::shared_ptr<Array> values;
+        RETURN_NOT_OK(value_builder.Finish(&values));
+        out->value = std::make_shared<ListScalar>(std::move(values));
+      } else {
+        out->value = MakeNullScalar(list(int32()));
+      }
+    }
+    return Status::OK();
+  }
+};
+
+const FunctionDoc match_substring_set_doc(
+    "Find the first of several patterns matching each string",
+    ("For each string in `strings`, emit the smallest id of a pattern it matches,\n"
+     "or null if it matches none of them.  Literal patterns and regular\n"
+     "expressions are given in MatchSubstringSetOptions; literal patterns are\n"
+     "numbered first, followed by the regular expressions.\n"
+     "If ignore_case is set, only simple case folding is performed.\n"
+     "\n"
+     "Null inputs emit null."),
+    {"strings"}, "MatchSubstringSetOptions", /*options_required=*/true);
+
+const FunctionDoc match_substring_set_all_doc(
+    "Find all of several patterns matching each string",
+    ("For each string in `strings`, emit the sorted list of ids of the patterns\n"
+     "it matches.  Literal patterns and regular expressions are given in\n"
+     "MatchSubstringSetOptions; literal patterns are numbered first, followed\n"
+     "by the regular expressions.\n"
+     "If ignore_case is set, only simple case folding is performed.\n"
+     "\n"
+     "Null inputs emit null."),
+    {"strings"}, "MatchSubstringSetOptions", /*options_required=*/true);
+
+void AddMatchSubstringSet(FunctionRegistry* registry) {
+  {
+    auto func = std::make_shared<ScalarFunction>("match_substring_set", Arity::Unary(),
+                                                 &match_substring_set_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      ScalarKernel kernel{{ty}, int32(),
+                          GenerateVarBinaryToVarBinary<MatchSubstringSetFirst>(ty),
+                          MatchSubstringSetState::Init};
+      kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+      kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+      DCHECK_OK(func->AddKernel(std::move(kernel)));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>(
+        "match_substring_set_all", Arity::Unary(), &match_substring_set_all_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      ScalarKernel kernel{{ty}, list(int32()),
+                          GenerateVarBinaryToVarBinary<MatchSubstringSetAll>(ty),
+                          MatchSubstringSetState::Init};
+      kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+      kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+      DCHECK_OK(func->AddKernel(std::move(kernel)));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
 // Substring find - lfind/index/etc.
 
 struct FindSubstring {
@@ -3050,6 +3480,7 @@ using ReplaceState = OptionsWrapper<ReplaceSubstringOptions>;
 
 template <typename Type, typename Replacer>
 struct ReplaceSubstring {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
   using ScalarType = typename TypeTraits<Type>::ScalarType;
   using offset_type = typename Type::offset_type;
   using ValueDataBuilder = TypedBufferBuilder<uint8_t>;
@@ -3072,6 +3503,10 @@ struct ReplaceSubstring {
       offset_builder.UnsafeAppend(0);  // offsets start at 0
 
       const ArrayData& input = *batch[0].array();
+      // Size the data buffer from the input up front: this is an upper bound
+      // unless replacements are longer than the matches they replace
+      RETURN_NOT_OK(value_data_builder.Reserve(
+          ArrayType(batch[0].array()).total_values_length()));
       RETURN_NOT_OK(VisitArrayDataInline<Type>(
           input,
           [&](util::string_view s) {
@@ -3814,6 +4249,47 @@ using Utf8Center = StringTransformExecWithState<Type, Utf8PadTransform<true, tru
 
 #ifdef ARROW_WITH_UTF8PROC
 
+// ASCII characters have Unicode whitespace properties matching
+// IsSpaceCharacterUnicode() for exactly these code units
+static inline bool IsSpaceCharacterUnicodeAscii(uint8_t c) {
+  return ((c >= 9) && (c <= 13)) || ((c >= 28) && (c <= 32));
+}
+
+// Trim the codepoints for which `keep` is false from either end of a string.
+// ASCII code units at the boundaries are tested with `keep_ascii` directly,
+// only decoding once a non-ASCII codepoint is reached.
+template <bool TrimLeft, bool TrimRight, typename AsciiPredicate, typename Predicate>
+int64_t TrimUTF8(const uint8_t* input, int64_t input_string_ncodeunits, uint8_t* output,
+                 AsciiPredicate&& keep_ascii, Predicate&& keep) {
+  const uint8_t* begin_trimmed = input;
+  const uint8_t* end_trimmed = input + input_string_ncodeunits;
+
+  if (TrimLeft) {
+    while (begin_trimmed < end_trimmed && *begin_trimmed < 0x80 &&
+           !keep_ascii(*begin_trimmed)) {
+      ++begin_trimmed;
+    }
+    if (begin_trimmed < end_trimmed && *begin_trimmed >= 0x80 &&
+        !ARROW_PREDICT_TRUE(arrow::util::UTF8FindIf(begin_trimmed, end_trimmed, keep,
+                                                    &begin_trimmed))) {
+      return kTransformError;
+    }
+  }
+  if (TrimRight) {
+    while (begin_trimmed < end_trimmed && end_trimmed[-1] < 0x80 &&
+           !keep_ascii(end_trimmed[-1])) {
+      --end_trimmed;
+    }
+    if (begin_trimmed < end_trimmed && end_trimmed[-1] >= 0x80 &&
+        !ARROW_PREDICT_TRUE(arrow::util::UTF8FindIfReverse(begin_trimmed, end_trimmed,
+                                                           keep, &end_trimmed))) {
+      return kTransformError;
+    }
+  }
+  std::copy(begin_trimmed, end_trimmed, output);
+  return end_trimmed - begin_trimmed;
+}
+
 template <bool TrimLeft, bool TrimRight>
 struct UTF8TrimWhitespaceTransform : public StringTransformBase {
   Status PreExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) override {
@@ -3823,24 +4299,10 @@ struct UTF8TrimWhitespaceTransform : public StringTransformBase {
 
   int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
                     uint8_t* output) {
-    const uint8_t* begin = input;
-    const uint8_t* end = input + input_string_ncodeunits;
-    const uint8_t* end_trimmed = end;
-    const uint8_t* begin_trimmed = begin;
-
-    auto predicate = [](uint32_t c) { return !IsSpaceCharacterUnicode(c); };
-    if (TrimLeft && !ARROW_PREDICT_TRUE(
-                        arrow::util::UTF8FindIf(begin, end, predicate, &begin_trimmed))) {
-      return kTransformError;
-    }
-    if (TrimRight && begin_trimmed < end) {
-      if (!ARROW_PREDICT_TRUE(arrow::util::UTF8FindIfReverse(begin_trimmed, end,
-                                                             predicate, &end_trimmed))) {
-        return kTransformError;
-      }
-    }
-    std::copy(begin_trimmed, end_trimmed, output);
-    return end_trimmed - begin_trimmed;
+    return TrimUTF8<TrimLeft, TrimRight>(
+        input, input_string_ncodeunits, output,
+        [](uint8_t c) { return !IsSpaceCharacterUnicodeAscii(c); },
+        [](uint32_t c) { return !IsSpaceCharacterUnicode(c); });
   }
 };
 
@@ -3888,25 +4350,11 @@ struct UTF8TrimTransform : public StringTransformBase {
 
   int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
                     uint8_t* output) {
-    const uint8_t* begin = input;
-    const uint8_t* end = input + input_string_ncodeunits;
-    const uint8_t* end_trimmed = end;
-    const uint8_t* begin_trimmed = begin;
     const auto& codepoints = state_.codepoints_;
 
     auto predicate = [&](uint32_t c) { return c >= codepoints.size() || !codepoints[c]; };
-    if (TrimLeft && !ARROW_PREDICT_TRUE(
-                        arrow::util::UTF8FindIf(begin, end, predicate, &begin_trimmed))) {
-      return kTransformError;
-    }
-    if (TrimRight && begin_trimmed < end) {
-      if (!ARROW_PREDICT_TRUE(arrow::util::UTF8FindIfReverse(begin_trimmed, end,
-                                                             predicate, &end_trimmed))) {
-        return kTransformError;
-      }
-    }
-    std::copy(begin_trimmed, end_trimmed, output);
-    return end_trimmed - begin_trimmed;
+    return TrimUTF8<TrimLeft, TrimRight>(input, input_string_ncodeunits, output,
+                                         predicate, predicate);
   }
 };
 
@@ -5134,6 +5582,258 @@ const FunctionDoc utf8_normalize_doc(
 
 }  // namespace
 
+// ----------------------------------------------------------------------
+// Dictionary-encoded inputs
+//
+// A unary string function is applied to the dictionary of a dictionary-encoded
+// input, so that each distinct value is only processed once.  Results that
+// are strings are returned with the input indices, other results (such as
+// booleans or lengths) are expanded through the indices with "take".
+
+class DictionaryOfBinaryMatcher : public TypeMatcher {
+ public:
+  bool Matches(const DataType& type) const override {
+    return type.id() == Type::DICTIONARY &&
+           is_base_binary_like(
+               checked_cast<const DictionaryType&>(type).value_type()->id());
+  }
+
+  bool Equals(const TypeMatcher& other) const override {
+    if (this == &other) {
+      return true;
+    }
+    auto casted = dynamic_cast<const DictionaryOfBinaryMatcher*>(&other);
+    return casted != nullptr;
+  }
+
+  std::string ToString() const override { return "dictionary<base-binary-like>"; }
+};
+
+struct DictionaryStringState : public KernelState {
+  explicit DictionaryStringState(const FunctionOptions* options) : options(options) {}
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext*,
+                                                   const KernelInitArgs& args) {
+    return ::arrow::internal::make_unique<DictionaryStringState>(args.options);
+  }
+
+  const FunctionOptions* options;
+};
+
+Result<ValueDescr> ResolveDictionaryStringOutput(const ScalarFunction& func,
+                                                 KernelContext* ctx,
+                                                 const std::vector<ValueDescr>& descrs) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*descrs[0].type);
+  const std::vector<ValueDescr> value_descrs = {
+      ValueDescr(dict_type.value_type(), descrs[0].shape)};
+  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, func.DispatchExact(value_descrs));
+
+  // The output type of the dictionary values may depend on the kernel state
+  KernelContext value_ctx(ctx != nullptr ? ctx->exec_context() : nullptr);
+  std::unique_ptr<KernelState> value_state;
+  if (kernel->init) {
+    const FunctionOptions* options =
+        (ctx != nullptr && ctx->state() != nullptr)
+            ? checked_cast<const DictionaryStringState&>(*ctx->state()).options
+            : func.default_options();
+    ARROW_ASSIGN_OR_RAISE(value_state,
+                          kernel->init(&value_ctx, {kernel, value_descrs, options}));
+    value_ctx.SetState(value_state.get());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out,
+                        kernel->signature->out_type().Resolve(&value_ctx, value_descrs));
+  if (is_base_binary_like(out.type->id())) {
+    out.type = dictionary(dict_type.index_type(), out.type);
+  }
+  return out;
+}
+
+// Drop the dictionary entries that no valid index refers to, so that the
+// function does not run (and possibly fail, e.g. on invalid UTF8) on them
+template <typename IndexType>
+Status CompactDictionary(KernelContext* ctx, std::shared_ptr<ArrayData>* input) {
+  using IndexCType = typename IndexType::c_type;
+  const ArrayData& data = **input;
+  const int64_t dict_length = data.dictionary->length;
+
+  std::vector<int64_t> transpose_map(dict_length, -1);
+  VisitArrayValuesInline<IndexType>(
+      data, [&](IndexCType index) { transpose_map[index] = 0; }, [] {});
+  int64_t num_referenced = 0;
+  for (int64_t& new_index : transpose_map) {
+    if (new_index == 0) {
+      new_index = num_referenced++;
+    }
+  }
+  if (num_referenced == dict_length) {
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto positions_buffer,
+                        ctx->Allocate(num_referenced * sizeof(int64_t)));
+  auto positions = reinterpret_cast<int64_t*>(positions_buffer->mutable_data());
+  for (int64_t i = 0; i < dict_length; ++i) {
+    if (transpose_map[i] >= 0) {
+      positions[transpose_map[i]] = i;
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      Datum dictionary,
+      Take(data.dictionary,
+           ArrayData::Make(int64(), num_referenced, {nullptr, positions_buffer}),
+           TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+
+  // Keep the offset, so that the validity bitmap can be reused
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        ctx->Allocate((data.offset + data.length) * sizeof(IndexCType)));
+  auto indices = reinterpret_cast<IndexCType*>(indices_buffer->mutable_data());
+  std::memset(indices, 0, data.offset * sizeof(IndexCType));
+  IndexCType* out_index = indices + data.offset;
+  VisitArrayValuesInline<IndexType>(
+      data,
+      [&](IndexCType index) {
+        *out_index++ = static_cast<IndexCType>(transpose_map[index]);
+      },
+      [&]() { *out_index++ = 0; });
+
+  auto compacted = ArrayData::Make(data.type, data.length,
+                                   {data.buffers[0], std::move(indices_buffer)},
+                                   data.null_count, data.offset);
+  compacted->dictionary = dictionary.array();
+  *input = std::move(compacted);
+  return Status::OK();
+}
+
+Status CompactDictionary(KernelContext* ctx, std::shared_ptr<ArrayData>* input) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*(*input)->type);
+  switch (dict_type.index_type()->id()) {
+    case Type::INT8:
+      return CompactDictionary<Int8Type>(ctx, input);
+    case Type::INT16:
+      return CompactDictionary<Int16Type>(ctx, input);
+    case Type::INT32:
+      return CompactDictionary<Int32Type>(ctx, input);
+    case Type::INT64:
+      return CompactDictionary<Int64Type>(ctx, input);
+    case Type::UINT8:
+      return CompactDictionary<UInt8Type>(ctx, input);
+    case Type::UINT16:
+      return CompactDictionary<UInt16Type>(ctx, input);
+    case Type::UINT32:
+      return CompactDictionary<UInt32Type>(ctx, input);
+    case Type::UINT64:
+      return CompactDictionary<UInt64Type>(ctx, input);
+    default:
+      return Status::TypeError("Invalid dictionary index type: ",
+                               dict_type.index_type()->ToString());
+  }
+}
+
+Status ExecDictionaryString(const ScalarFunction& func, KernelContext* ctx,
+                            const ExecBatch& batch, Datum* out) {
+  const auto& state = checked_cast<const DictionaryStringState&>(*ctx->state());
+  const bool encode_output = out->type()->id() == Type::DICTIONARY;
+
+  if (batch[0].is_scalar()) {
+    const auto& input = checked_cast<const DictionaryScalar&>(*batch[0].scalar());
+    if (encode_output) {
+      // Only compute the referenced entry, which becomes the whole dictionary
+      std::shared_ptr<Scalar> index = input.value.index;
+      std::shared_ptr<Array> dictionary = input.value.dictionary->Slice(0, 0);
+      if (input.is_valid) {
+        ARROW_ASSIGN_OR_RAISE(index, MakeScalar(index->type, 0));
+        ARROW_ASSIGN_OR_RAISE(auto value, input.GetEncodedValue());
+        ARROW_ASSIGN_OR_RAISE(dictionary,
+                              MakeArrayFromScalar(*value, 1, ctx->memory_pool()));
+      }
+      ARROW_ASSIGN_OR_RAISE(Datum values, CallFunction(func.name(), {dictionary},
+                                                       state.options,
+                                                       ctx->exec_context()));
+      out->value = std::make_shared<DictionaryScalar>(
+          DictionaryScalar::ValueType{std::move(index), values.make_array()},
+          out->type(), input.is_valid);
+    } else if (input.is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto value, input.GetEncodedValue());
+      ARROW_ASSIGN_OR_RAISE(*out, CallFunction(func.name(), {value}, state.options,
+                                               ctx->exec_context()));
+    } else {
+      out->value = MakeNullScalar(out->type());
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<ArrayData> input_data = batch[0].array();
+  RETURN_NOT_OK(CompactDictionary(ctx, &input_data));
+  const ArrayData& input = *input_data;
+  ARROW_ASSIGN_OR_RAISE(Datum values, CallFunction(func.name(), {input.dictionary},
+                                                   state.options, ctx->exec_context()));
+  if (encode_output) {
+    auto result = input.Copy();
+    result->type = out->type();
+    result->dictionary = values.array();
+    out->value = std::move(result);
+  } else {
+    auto indices = input.Copy();
+    indices->type = checked_cast<const DictionaryType&>(*input.type).index_type();
+    indices->dictionary = nullptr;
+    ARROW_ASSIGN_OR_RAISE(*out, Take(values, Datum(std::move(indices)),
+                                     TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+  }
+  return Status::OK();
+}
+
+void AddDictionaryStringKernel(const std::string& name, FunctionRegistry* registry) {
+  auto maybe_func = registry->GetFunction(name);
+  DCHECK_OK(maybe_func.status());
+  auto func = checked_cast<ScalarFunction*>(maybe_func.ValueOrDie().get());
+
+  OutputType out_type(
+      [func](KernelContext* ctx, const std::vector<ValueDescr>& descrs) {
+        return ResolveDictionaryStringOutput(*func, ctx, descrs);
+      });
+  auto exec = [func](KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    return ExecDictionaryString(*func, ctx, batch, out);
+  };
+  ScalarKernel kernel{{InputType(std::make_shared<DictionaryOfBinaryMatcher>())},
+                      std::move(out_type), std::move(exec), DictionaryStringState::Init};
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+void AddDictionaryStringKernels(FunctionRegistry* registry) {
+  for (const char* name :
+       {"ascii_upper", "ascii_lower", "ascii_swapcase", "ascii_capitalize", "ascii_title",
+        "ascii_trim_whitespace", "ascii_ltrim_whitespace", "ascii_rtrim_whitespace",
+        "ascii_reverse", "utf8_reverse", "ascii_center", "ascii_lpad", "ascii_rpad",
+        "utf8_center", "utf8_lpad", "utf8_rpad", "ascii_trim", "ascii_ltrim",
+        "ascii_rtrim", "string_is_ascii", "ascii_is_alnum", "ascii_is_alpha",
+        "ascii_is_decimal", "ascii_is_lower", "ascii_is_printable", "ascii_is_space",
+        "ascii_is_title", "ascii_is_upper", "binary_length", "utf8_length",
+        "match_substring", "starts_with", "ends_with", "match_substring_set",
+        "find_substring", "count_substring", "replace_substring", "binary_replace_slice",
+        "utf8_replace_slice", "utf8_slice_codeunits", "binary_reverse"}) {
+    AddDictionaryStringKernel(name, registry);
+  }
+#ifdef ARROW_WITH_UTF8PROC
+  for (const char* name :
+       {"utf8_upper", "utf8_lower", "utf8_swapcase", "utf8_capitalize", "utf8_title",
+        "utf8_trim_whitespace", "utf8_ltrim_whitespace", "utf8_rtrim_whitespace",
+        "utf8_trim", "utf8_ltrim", "utf8_rtrim", "utf8_is_alnum", "utf8_is_alpha",
+        "utf8_is_decimal", "utf8_is_digit", "utf8_is_lower", "utf8_is_numeric",
+        "utf8_is_printable", "utf8_is_space", "utf8_is_title", "utf8_is_upper",
+        "utf8_normalize"}) {
+    AddDictionaryStringKernel(name, registry);
+  }
+#endif
+#ifdef ARROW_WITH_RE2
+  for (const char* name : {"match_substring_regex", "match_like", "find_substring_regex",
+                           "count_substring_regex", "replace_substring_regex"}) {
+    AddDictionaryStringKernel(name, registry);
+  }
+#endif
+}
+
 void RegisterScalarStringAscii(FunctionRegistry* registry) {
   // Some kernels are able to reuse the original offsets buffer, so don't
   // preallocate them in the output. Only kernels that invoke
@@ -5226,6 +5926,7 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
   AddBinaryLength(registry);
   AddUtf8Length(registry);
   AddMatchSubstring(registry);
+  AddMatchSubstringSet(registry);
   AddFindSubstring(registry);
   AddCountSubstring(registry);
   AddReplaceSubstring(registry);
@@ -5239,6 +5940,8 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
   AddBinaryJoin(registry);
   AddBinaryRepeat(registry);
   AddBinaryReverse(registry);
+
+  AddDictionaryStringKernels(registry);
 }
 
 }  // namespace internal
@@ -504,6 +504,67 @@ TYPED_TEST(TestBaseBinaryKernels, FindSubstringIgnoreCase) {
 }
 #endif
 
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSet) {
+  MatchSubstringSetOptions options{{"he", "she", "his", "hers"}};
+  this->CheckUnary("match_substring_set", "[]", int32(), "[]", &options);
+  this->CheckUnary("match_substring_set",
+                   R"(["ushers", "his", "xyz", null, "", "she", "hishe"])", int32(),
+                   "[0, 2, null, null, null, 0, 0]", &options);
+  this->CheckUnary("match_substring_set_all", "[]", list(int32()), "[]", &options);
+  this->CheckUnary("match_substring_set_all",
+                   R"(["ushers", "his", "xyz", null, "", "she", "hishe"])",
+                   list(int32()), "[[0, 1, 3], [2], [], null, [], [0, 1], [0, 1, 2]]",
+                   &options);
+
+  // Empty patterns match everything, duplicate patterns are reported separately
+  MatchSubstringSetOptions options_empty{{"b", "", "b"}};
+  this->CheckUnary("match_substring_set", R"(["", "ab", null])", int32(),
+                   "[1, 0, null]", &options_empty);
+  this->CheckUnary("match_substring_set_all", R"(["", "ab", null])", list(int32()),
+                   "[[1], [0, 1, 2], null]", &options_empty);
+
+  MatchSubstringSetOptions options_none{{}};
+  this->CheckUnary("match_substring_set", R"(["", "ab", null])", int32(),
+                   "[null, null, null]", &options_none);
+  this->CheckUnary("match_substring_set_all", R"(["", "ab", null])", list(int32()),
+                   "[[], [], null]", &options_none);
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSetRegex) {
+  MatchSubstringSetOptions options{{"ab", "cd"}, {"a+b", "^c", "x?"}};
+  this->CheckUnary("match_substring_set", R"(["aab", "cd", "dc", "AB", null])",
+                   int32(), "[0, 1, 4, 4, null]", &options);
+  this->CheckUnary("match_substring_set_all", R"(["aab", "cd", "dc", "AB", null])",
+                   list(int32()), "[[0, 2, 4], [1, 3, 4], [4], [4], null]", &options);
+
+  options.ignore_case = true;
+  this->CheckUnary("match_substring_set", R"(["aab", "CD", "dc", "AB", null])",
+                   int32(), "[0, 1, 4, 0, null]", &options);
+  this->CheckUnary("match_substring_set_all", R"(["aab", "CD", "dc", "AB", null])",
+                   list(int32()), "[[0, 2, 4], [1, 3, 4], [4], [0, 2, 4], null]",
+                   &options);
+
+  MatchSubstringSetOptions options_literal{{"a+", "(b"}, {}, /*ignore_case=*/true};
+  this->CheckUnary("match_substring_set_all", R"(["A+(B", "aab"])", list(int32()),
+                   "[[0, 1], []]", &options_literal);
+
+  MatchSubstringSetOptions options_invalid{{}, {"("}};
+  Datum input = ArrayFromJSON(this->type(), R"(["a"])");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid regular expression"),
+      CallFunction("match_substring_set", {input}, &options_invalid));
+}
+#else
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSetRegex) {
+  MatchSubstringSetOptions options{{"a"}, {"a+"}};
+  Datum input = ArrayFromJSON(this->type(), R"(["a"])");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  ::testing::HasSubstr("regex_patterns require RE2"),
+                                  CallFunction("match_substring_set", {input}, &options));
+}
+#endif
+
 TYPED_TEST(TestBaseBinaryKernels, CountSubstring) {
   MatchSubstringOptions options{"aba"};
   this->CheckUnary("count_substring", "[]", this->offset_type(), "[]", &options);
@@ -925,6 +986,50 @@ TYPED_TEST(TestStringKernels, AsciiReverse) {
                    ArrayFromJSON(this->type(), R"([null, null, "", "dcb"])"));
 }
 
+TYPED_TEST(TestStringKernels, DictionaryInput) {
+  auto dict_type = dictionary(int8(), this->type());
+  auto input = DictArrayFromJSON(dict_type, "[0, 1, null, 2, 3, 1, 0]",
+                                 R"(["foo", "Bar", null, "bazfoo"])");
+
+  // String results keep the indices of the input
+  CheckDictionary("ascii_upper", {input});
+  ASSERT_OK_AND_ASSIGN(Datum upper, CallFunction("ascii_upper", {input}));
+  AssertArraysEqual(*checked_cast<const DictionaryArray&>(*input).indices(),
+                    *checked_cast<const DictionaryArray&>(*upper.make_array()).indices());
+
+  // Other results are decoded
+  CheckDictionary("utf8_length", {input}, /*result_is_encoded=*/false);
+  MatchSubstringOptions options{"foo"};
+  this->CheckUnary("match_substring", input, boolean(),
+                   "[true, false, null, null, true, false, true]", &options);
+}
+
+TYPED_TEST(TestStringKernels, DictionaryInputUnusedEntries) {
+  // Dictionary entries that no valid index refers to are not computed over,
+  // so an invalid unused entry does not fail the call
+  for (const auto& index_type : {int8(), uint16(), int64()}) {
+    ARROW_SCOPED_TRACE("index type = ", index_type->ToString());
+    auto dict_type = dictionary(index_type, this->type());
+    auto input = DictArrayFromJSON(dict_type, "[3, null, 0, 3, 0]",
+                                   R"(["abc", "aAazZæÆ&", null, "de"])");
+    CheckDictionary("ascii_reverse", {input});
+    CheckDictionary("string_is_ascii", {input}, /*result_is_encoded=*/false);
+
+    ASSERT_OK_AND_ASSIGN(Datum reversed, CallFunction("ascii_reverse", {input}));
+    const auto& reversed_array =
+        checked_cast<const DictionaryArray&>(*reversed.make_array());
+    AssertArraysEqual(*ArrayFromJSON(this->type(), R"(["cba", "ed"])"),
+                      *reversed_array.dictionary());
+
+    // Referenced entries are still computed over
+    auto invalid_input = DictArrayFromJSON(dict_type, "[3, 1, 0]",
+                                           R"(["abc", "aAazZæÆ&", null, "de"])");
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid,
+                                    testing::HasSubstr("Non-ASCII sequence in input"),
+                                    CallFunction("ascii_reverse", {invalid_input}));
+  }
+}
+
 TYPED_TEST(TestStringKernels, Utf8Reverse) {
   this->CheckUnary("utf8_reverse", "[]", this->type(), "[]");
   this->CheckUnary("utf8_reverse", R"(["abcd", null, "", "bbb"])", this->type(),
@@ -1037,6 +1142,12 @@ TYPED_TEST(TestStringKernels, Utf8Length) {
   this->CheckUnary("utf8_length",
                    R"(["aaa", null, "áéíóú", "ɑɽⱤoW😀", "áéí 0😀", "", "b"])",
                    this->offset_type(), "[3, null, 5, 6, 6, 0, 1]");
+  // Long ASCII runs with multi-byte characters in between and at the end
+  this->CheckUnary("utf8_length",
+                   R"(["abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOP",
+                       "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOáé",
+                       "áéíóúabcdefghijklmnopqrstuvwxyz0123456789😀ɑɽⱤoWabcdefgh"])",
+                   this->offset_type(), "[52, 53, 57]");
 }
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -1056,6 +1167,15 @@ TYPED_TEST(TestStringKernels, Utf8Upper) {
   // test maximum buffer growth
   this->CheckUnary("utf8_upper", "[\"ɑɑɑɑ\"]", this->type(), "[\"ⱭⱭⱭⱭ\"]");
 
+  // ASCII runs longer than a SIMD block, followed by non-ASCII characters
+  this->CheckUnary(
+      "utf8_upper",
+      R"(["abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyzæ",
+          "ɑabcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyzɑ!"])",
+      this->type(),
+      R"(["ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZÆ",
+          "ⱭABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZⱭ!"])");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"ɑa\xFFɑ\", \"ɽ\xe1\xbdɽaa\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -1078,6 +1198,15 @@ TYPED_TEST(TestStringKernels, Utf8Lower) {
   // test maximum buffer growth
   this->CheckUnary("utf8_lower", "[\"ȺȺȺȺ\"]", this->type(), "[\"ⱥⱥⱥⱥ\"]");
 
+  // ASCII runs longer than a SIMD block, followed by non-ASCII characters
+  this->CheckUnary(
+      "utf8_lower",
+      R"(["ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZÆ",
+          "ȺABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZȺ!"])",
+      this->type(),
+      R"(["abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyzæ",
+          "ⱥabcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyzⱥ!"])");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"Ⱥa\xFFⱭ\", \"Ɽ\xe1\xbdⱤaA\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -1957,6 +2086,10 @@ TYPED_TEST(TestStringKernels, TrimWhitespaceUTF8) {
   this->CheckUnary("utf8_ltrim_whitespace",
                    "[\" \\tfoo\", null, \"bar  \", \" \xe2\x80\x88 foo bar \"]",
                    this->type(), "[\"foo\", null, \"bar  \", \"foo bar \"]");
+  // ASCII control characters with Unicode whitespace properties
+  this->CheckUnary("utf8_trim_whitespace",
+                   "[\"\\u001c\\u001ffoo\\u001e\\r\", \"\\u0001foo\\u001b\"]",
+                   this->type(), "[\"foo\", \"\\u0001foo\\u001b\"]");
 }
 
 TYPED_TEST(TestStringKernels, TrimUTF8) {
@@ -599,6 +599,24 @@ TEST_F(ScalarTemporalTest, TestZoned2) {
   }
 }
 
+TEST_F(ScalarTemporalTest, TestZonedUnsortedTransitions) {
+  // Unsorted timestamps on both sides of DST transitions, with repeats, so
+  // that cached UTC offset periods are looked up out of order
+  const char* times = R"(["2021-03-14T06:59:59", "2021-11-07T05:59:59",
+                          "1995-06-01T12:00:00", "2021-03-14T07:00:00",
+                          "2021-11-07T06:00:00", "2021-03-14T06:59:59",
+                          "1995-06-01T12:00:00", "2021-11-07T05:59:59",
+                          "1900-01-01T00:00:00", "2021-11-07T06:00:00",
+                          "2021-03-14T07:00:00", null])";
+  auto hour = "[1, 1, 8, 3, 1, 1, 8, 1, 19, 1, 3, null]";
+  auto day = "[14, 7, 1, 14, 7, 14, 1, 7, 31, 7, 14, null]";
+  for (auto u : TimeUnit::values()) {
+    auto unit = timestamp(u, "America/New_York");
+    CheckScalarUnary("hour", unit, times, int64(), hour);
+    CheckScalarUnary("day", unit, times, int64(), day);
+  }
+}
+
 TEST_F(ScalarTemporalTest, TestNonexistentTimezone) {
   auto data_buffer = Buffer::Wrap(std::vector<int32_t>{1, 2, 3});
   auto null_buffer = Buffer::FromString("\xff");
@@ -698,8 +698,9 @@ struct ISOCalendarVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
+    const ZonedLocalizer localizer{tz};
     return [=](TimestampType::c_type arg) {
-      const auto iso_calendar = GetIsoCalendar<Duration>(arg, ZonedLocalizer{tz});
+      const auto iso_calendar = GetIsoCalendar<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(iso_calendar[0]);
       field_builders[1]->UnsafeAppend(iso_calendar[1]);
       field_builders[2]->UnsafeAppend(iso_calendar[2]);
@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/vendored/datetime.h"
@@ -34,6 +35,8 @@ using arrow_vendored::date::local_days;
 using arrow_vendored::date::local_time;
 using arrow_vendored::date::locate_zone;
 using arrow_vendored::date::sys_days;
+using arrow_vendored::date::sys_info;
+using arrow_vendored::date::sys_seconds;
 using arrow_vendored::date::sys_time;
 using arrow_vendored::date::time_zone;
 using arrow_vendored::date::year_month_day;
@@ -102,18 +105,87 @@ struct NonZonedLocalizer {
   sys_days ConvertDays(sys_days d) const { return d; }
 };
 
+// Cache of the UTC offset periods of a timezone.
+//
+// time_zone::get_info() searches the timezone's transitions and copies the
+// period's abbreviation on every call.  Periods looked up so far are kept
+// sorted so that the offset of an already seen period is found by checking
+// the last hit (sorted or clustered input) or by a binary search, without
+// touching the timezone database.
+class TimezoneOffsetCache {
+ public:
+  explicit TimezoneOffsetCache(const time_zone* tz) : tz_(tz) {}
+
+  std::chrono::seconds GetOffset(sys_seconds t) const {
+    const int64_t s = t.time_since_epoch().count();
+    if (ARROW_PREDICT_TRUE(s >= last_.begin && s < last_.end)) {
+      return std::chrono::seconds{last_.offset};
+    }
+    // Branchless binary search for the last period starting at or before `s`
+    const int64_t* begins = begins_.data();
+    size_t index = 0;
+    size_t length = begins_.size();
+    while (length > 1) {
+      const size_t half = length / 2;
+      index = (begins[index + half] <= s) ? index + half : index;
+      length -= half;
+    }
+    const bool found_before = !begins_.empty() && begins[index] <= s;
+    if (found_before && s < periods_[index].end) {
+      last_ = periods_[index];
+    } else {
+      size_t pos = found_before ? index + 1 : index;
+      if (periods_.size() >= kMaxPeriods) {
+        periods_.clear();
+        begins_.clear();
+        pos = 0;
+      }
+      const sys_info info = tz_->get_info(t);
+      last_ = Period{info.begin.time_since_epoch().count(),
+                     info.end.time_since_epoch().count(), info.offset.count()};
+      periods_.insert(periods_.begin() + pos, last_);
+      begins_.insert(begins_.begin() + pos, last_.begin);
+    }
+    return std::chrono::seconds{last_.offset};
+  }
+
+ private:
+  struct Period {
+    int64_t begin;
+    int64_t end;
+    int64_t offset;
+  };
+
+  // Timezones have a few hundred transitions at most, but rule-based periods
+  // far in the future are unbounded
+  static constexpr size_t kMaxPeriods = 4096;
+
+  const time_zone* tz_;
+  mutable Period last_ = {0, 0, 0};
+  mutable std::vector<Period> periods_;
+  // Copy of the periods' begin times, for a cache-friendly search
+  mutable std::vector<int64_t> begins_;
+};
+
 struct ZonedLocalizer {
   using days_t = local_days;
 
+  explicit ZonedLocalizer(const time_zone* tz) : tz(tz), offsets_(tz) {}
+
   // Timezone-localizing conversions: UTC -> local time
   const time_zone* tz;
 
   template <typename Duration>
   local_time<Duration> ConvertTimePoint(int64_t t) const {
-    return tz->to_local(sys_time<Duration>(Duration{t}));
+    const sys_time<Duration> st(Duration{t});
+    const auto offset = offsets_.GetOffset(floor<std::chrono::seconds>(st));
+    return local_time<Duration>((st + offset).time_since_epoch());
   }
 
   local_days ConvertDays(sys_days d) const { return local_days(year_month_day(d)); }
+
+ private:
+  TimezoneOffsetCache offsets_;
 };
 
 template <typename Duration>
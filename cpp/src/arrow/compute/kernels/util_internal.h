@@ -26,6 +26,8 @@
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/type_fwd.h"
 #include "arrow/util/bit_run_reader.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/math_constants.h"
 
 namespace arrow {
@@ -161,6 +163,54 @@ int64_t CopyNonNullValues(const Datum& datum, T* out) {
   return n;
 }
 
+// ----------------------------------------------------------------------
+// Decimal128 values that fit in an int64
+
+// A Decimal128 of precision 18 or less fits in an int64: the high word of its two's
+// complement representation is just the sign extension of the low word.
+constexpr int32_t kMaxDecimal128PrecisionInInt64 = 18;
+
+#if ARROW_LITTLE_ENDIAN
+constexpr int kDecimal128LowWord = 0;
+#else
+constexpr int kDecimal128LowWord = 1;
+#endif
+
+inline bool Decimal128FitsInInt64(const DataType& type) {
+  return ::arrow::internal::checked_cast<const Decimal128Type&>(type).precision() <=
+         kMaxDecimal128PrecisionInInt64;
+}
+
+// The values of a Decimal128 array, or the value of a Decimal128 scalar, read as
+// int64. Only meaningful if Decimal128FitsInInt64(datum.type()).
+struct Decimal128Int64Values {
+  explicit Decimal128Int64Values(const Datum& datum) {
+    if (datum.is_scalar()) {
+      const auto& scalar =
+          ::arrow::internal::checked_cast<const Decimal128Scalar&>(*datum.scalar());
+      words = reinterpret_cast<const int64_t*>(scalar.value.native_endian_bytes());
+    } else {
+      const ArrayData& arr = *datum.array();
+      words = reinterpret_cast<const int64_t*>(arr.buffers[1]->data()) + 2 * arr.offset;
+    }
+    words += kDecimal128LowWord;
+  }
+
+  // Value i of an array, or the scalar's value if kIsScalar
+  template <bool kIsScalar = false>
+  int64_t Get(int64_t i) const {
+    return words[kIsScalar ? 0 : 2 * i];
+  }
+
+  const int64_t* words;
+};
+
+// Store an int64 as the Decimal128 at out[2 * i]
+inline void PutDecimal128FromInt64(int64_t value, int64_t* out, int64_t i) {
+  out[2 * i + kDecimal128LowWord] = value;
+  out[2 * i + 1 - kDecimal128LowWord] = value >> 63;
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
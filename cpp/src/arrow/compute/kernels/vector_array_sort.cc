@@ -16,7 +16,9 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <numeric>
@@ -309,9 +311,190 @@ class ArrayCountSorter<BooleanType> {
   }
 };
 
-// Sort integers with counting sort or comparison based sorting algorithm
+// Order-preserving unsigned keys for radix sorting.  Comparing two keys digit by digit
+// (most significant first) orders them like the values they were made from.
+
+template <typename ArrowType, typename Enable = void>
+struct RadixSortKey {};
+
+template <typename ArrowType>
+struct RadixSortKey<ArrowType, enable_if_t<is_integer_type<ArrowType>::value>> {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename ArrowType::c_type;
+  using Key = typename std::make_unsigned<c_type>::type;
+  static constexpr int kNumDigits = sizeof(Key);
+
+  static Key Make(const ArrayType& values, int64_t i) {
+    // Flip the sign bit so that negative values order before positive ones
+    constexpr Key kSignBit = std::is_signed<c_type>::value
+                                 ? static_cast<Key>(Key(1) << (8 * sizeof(Key) - 1))
+                                 : Key(0);
+    return static_cast<Key>(static_cast<Key>(values.Value(i)) ^ kSignBit);
+  }
+  static uint8_t Digit(Key key, int digit) {
+    return static_cast<uint8_t>(key >> (8 * digit));
+  }
+  static Key Invert(Key key) { return static_cast<Key>(~key); }
+};
+
+// HalfFloatType values are stored as uint16_t and are not radix sorted
+template <typename ArrowType>
+using is_radix_sortable_floating_type =
+    std::integral_constant<bool, is_floating_type<ArrowType>::value &&
+                                     !std::is_same<ArrowType, HalfFloatType>::value>;
+
+template <typename ArrowType>
+struct RadixSortKey<ArrowType,
+                    enable_if_t<is_radix_sortable_floating_type<ArrowType>::value>> {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename ArrowType::c_type;
+  using Key = typename std::conditional<sizeof(c_type) == 4, uint32_t, uint64_t>::type;
+  static constexpr int kNumDigits = sizeof(Key);
+
+  // NaNs must have been partitioned out
+  static Key Make(const ArrayType& values, int64_t i) {
+    constexpr Key kSignBit = Key(1) << (8 * sizeof(Key) - 1);
+    c_type value = values.Value(i);
+    // -0.0 and 0.0 compare equal, so they must have equal keys to keep the sort stable
+    if (value == 0) {
+      value = 0;
+    }
+    Key bits;
+    std::memcpy(&bits, &value, sizeof(Key));
+    // Negative values order in reverse of their magnitude
+    return (bits & kSignBit) ? static_cast<Key>(~bits) : (bits | kSignBit);
+  }
+  static uint8_t Digit(Key key, int digit) {
+    return static_cast<uint8_t>(key >> (8 * digit));
+  }
+  static Key Invert(Key key) { return static_cast<Key>(~key); }
+};
+
+template <typename ArrowType>
+struct RadixSortKey<ArrowType, enable_if_decimal<ArrowType>> {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using DecimalType = typename TypeTraits<ArrowType>::CType;
+  static constexpr int kNumWords = ArrowType::kByteWidth / 8;
+  // Little endian words, the last one is the most significant
+  using Key = std::array<uint64_t, kNumWords>;
+  static constexpr int kNumDigits = ArrowType::kByteWidth;
+
+  static Key Make(const ArrayType& values, int64_t i) {
+    Key key = DecimalType(values.GetValue(i)).little_endian_array();
+    key[kNumWords - 1] ^= uint64_t(1) << 63;
+    return key;
+  }
+  static uint8_t Digit(const Key& key, int digit) {
+    return static_cast<uint8_t>(key[digit / 8] >> (8 * (digit % 8)));
+  }
+  static Key Invert(Key key) {
+    for (auto& word : key) {
+      word = ~word;
+    }
+    return key;
+  }
+};
+
+// Sort fixed-width values with a stable LSD radix sort, one byte of the key per pass.
+// Passes over a byte which is the same in all keys are skipped, so values spanning a
+// narrow range take fewer passes.
+template <typename ArrowType>
+class ArrayRadixSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using KeyTraits = RadixSortKey<ArrowType>;
+  using Key = typename KeyTraits::Key;
+  static constexpr int kNumDigits = KeyTraits::kNumDigits;
+
+ public:
+  // `offset` is used when this is called on a chunk of a chunked array
+  NullPartitionResult operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                 const Array& array, int64_t offset,
+                                 const ArraySortOptions& options) {
+    const auto& values = checked_cast<const ArrayType&>(array);
+
+    const auto p = PartitionNulls<ArrayType, StablePartitioner>(
+        indices_begin, indices_end, values, offset, options.null_placement);
+    const int64_t length = p.non_nulls_end - p.non_nulls_begin;
+    if (length < 2) {
+      return p;
+    }
+
+    // Sorting inverted keys in ascending order is a stable descending sort
+    const bool invert = options.order == SortOrder::Descending;
+    std::vector<Key> keys(length);
+    std::vector<int64_t> counts(kNumDigits * 256, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      Key key = KeyTraits::Make(values, p.non_nulls_begin[i] - offset);
+      if (invert) {
+        key = KeyTraits::Invert(key);
+      }
+      for (int digit = 0; digit < kNumDigits; ++digit) {
+        ++counts[digit * 256 + KeyTraits::Digit(key, digit)];
+      }
+      keys[i] = key;
+    }
+
+    std::vector<Key> keys_scratch(length);
+    std::vector<uint64_t> indices_scratch(length);
+    Key* keys_in = keys.data();
+    Key* keys_out = keys_scratch.data();
+    uint64_t* indices_in = p.non_nulls_begin;
+    uint64_t* indices_out = indices_scratch.data();
+
+    for (int digit = 0; digit < kNumDigits; ++digit) {
+      int64_t* offsets = &counts[digit * 256];
+      if (offsets[KeyTraits::Digit(keys_in[0], digit)] == length) {
+        continue;
+      }
+      // Turn counts into output offsets
+      int64_t sum = 0;
+      for (int bucket = 0; bucket < 256; ++bucket) {
+        const int64_t count = offsets[bucket];
+        offsets[bucket] = sum;
+        sum += count;
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t pos = offsets[KeyTraits::Digit(keys_in[i], digit)]++;
+        keys_out[pos] = keys_in[i];
+        indices_out[pos] = indices_in[i];
+      }
+      std::swap(keys_in, keys_out);
+      std::swap(indices_in, indices_out);
+    }
+
+    if (indices_in != p.non_nulls_begin) {
+      std::copy(indices_in, indices_in + length, p.non_nulls_begin);
+    }
+    return p;
+  }
+};
+
+// Sort with LSD radix sort if the array is long enough to amortize its per-pass cost,
+// with std::stable_sort otherwise
+template <typename ArrowType>
+class ArrayRadixOrCompareSorter {
+ public:
+  // `offset` is used when this is called on a chunk of a chunked array
+  NullPartitionResult operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                 const Array& array, int64_t offset,
+                                 const ArraySortOptions& options) {
+    if (array.length() - array.null_count() >= radixsort_min_len_) {
+      return radix_sorter_(indices_begin, indices_end, array, offset, options);
+    }
+    return compare_sorter_(indices_begin, indices_end, array, offset, options);
+  }
+
+ private:
+  ArrayCompareSorter<ArrowType> compare_sorter_;
+  ArrayRadixSorter<ArrowType> radix_sorter_;
+
+  static const int64_t radixsort_min_len_ = 1024;
+};
+
+// Sort integers with counting sort, radix sort or comparison based sorting algorithm
 // - Use O(n) counting sort if values are in a small range
-// - Use O(nlogn) std::stable_sort otherwise
+// - Use O(n) radix sort for long arrays otherwise
+// - Use O(nlogn) std::stable_sort for short arrays
 template <typename ArrowType>
 class ArrayCountOrCompareSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -337,11 +520,11 @@ class ArrayCountOrCompareSorter {
       }
     }
 
-    return compare_sorter_(indices_begin, indices_end, values, offset, options);
+    return radix_or_compare_sorter_(indices_begin, indices_end, values, offset, options);
   }
 
  private:
-  ArrayCompareSorter<ArrowType> compare_sorter_;
+  ArrayRadixOrCompareSorter<ArrowType> radix_or_compare_sorter_;
   ArrayCountSorter<ArrowType> count_sorter_;
 
   // Cross point to prefer counting sort than stl::stable_sort(merge sort)
@@ -404,9 +587,16 @@ struct ArraySorter<Type, enable_if_t<is_integer_type<Type>::value &&
 };
 
 template <typename Type>
-struct ArraySorter<
-    Type, enable_if_t<is_floating_type<Type>::value || is_base_binary_type<Type>::value ||
-                      is_fixed_size_binary_type<Type>::value>> {
+struct ArraySorter<Type, enable_if_t<is_radix_sortable_floating_type<Type>::value ||
+                                     is_decimal_type<Type>::value>> {
+  ArrayRadixOrCompareSorter<Type> impl;
+};
+
+template <typename Type>
+struct ArraySorter<Type, enable_if_t<std::is_same<Type, HalfFloatType>::value ||
+                                     is_base_binary_type<Type>::value ||
+                                     (is_fixed_size_binary_type<Type>::value &&
+                                      !is_decimal_type<Type>::value)>> {
   ArrayCompareSorter<Type> impl;
 };
 
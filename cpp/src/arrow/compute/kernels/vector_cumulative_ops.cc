@@ -0,0 +1,387 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/int_util_internal.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+using arrow::internal::AddWithOverflow;
+using arrow::internal::MultiplyWithOverflow;
+
+// ----------------------------------------------------------------------
+// Binary operations folded over the input
+//
+// Each op provides the identity of the operation and a Call() combining the
+// running value with the next input value.  Checked ops report overflow through
+// the Status argument; the first error wins.
+
+struct CumulativeSumOp {
+  template <typename T>
+  static constexpr T Identity() {
+    return 0;
+  }
+
+  template <typename T>
+  static enable_if_floating_value<T> Call(T left, T right, Status*) {
+    return left + right;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_integer_value<T> Call(T left, T right, Status*) {
+    return static_cast<T>(left + right);
+  }
+
+  template <typename T>
+  static enable_if_signed_integer_value<T> Call(T left, T right, Status*) {
+    return arrow::internal::SafeSignedAdd(left, right);
+  }
+};
+
+struct CumulativeSumCheckedOp {
+  template <typename T>
+  static constexpr T Identity() {
+    return 0;
+  }
+
+  template <typename T>
+  static enable_if_floating_value<T> Call(T left, T right, Status*) {
+    return left + right;
+  }
+
+  template <typename T>
+  static enable_if_integer_value<T> Call(T left, T right, Status* st) {
+    T result = 0;
+    if (ARROW_PREDICT_FALSE(AddWithOverflow(left, right, &result)) && st->ok()) {
+      *st = Status::Invalid("overflow");
+    }
+    return result;
+  }
+};
+
+struct CumulativeProdOp {
+  template <typename T>
+  static constexpr T Identity() {
+    return 1;
+  }
+
+  template <typename T>
+  static enable_if_floating_value<T> Call(T left, T right, Status*) {
+    return left * right;
+  }
+
+  template <typename T>
+  static enable_if_integer_value<T> Call(T left, T right, Status*) {
+    // Multiply as unsigned so that overflow wraps around instead of being undefined,
+    // widening small types which would otherwise be promoted to (signed) int
+    using Unsigned = typename std::make_unsigned<T>::type;
+    using Wide = typename std::conditional<(sizeof(T) < sizeof(unsigned int)),
+                                           unsigned int, Unsigned>::type;
+    return static_cast<T>(static_cast<Wide>(left) * static_cast<Wide>(right));
+  }
+};
+
+struct CumulativeProdCheckedOp {
+  template <typename T>
+  static constexpr T Identity() {
+    return 1;
+  }
+
+  template <typename T>
+  static enable_if_floating_value<T> Call(T left, T right, Status*) {
+    return left * right;
+  }
+
+  template <typename T>
+  static enable_if_integer_value<T> Call(T left, T right, Status* st) {
+    T result = 0;
+    if (ARROW_PREDICT_FALSE(MultiplyWithOverflow(left, right, &result)) && st->ok()) {
+      *st = Status::Invalid("overflow");
+    }
+    return result;
+  }
+};
+
+// Unlike the min_max aggregate, a NaN is propagated through the rest of the output
+// as it is for the sum and product.
+struct CumulativeMaxOp {
+  template <typename T>
+  static constexpr enable_if_floating_value<T> Identity() {
+    return -std::numeric_limits<T>::infinity();
+  }
+
+  template <typename T>
+  static constexpr enable_if_integer_value<T> Identity() {
+    return std::numeric_limits<T>::lowest();
+  }
+
+  template <typename T>
+  static enable_if_floating_value<T> Call(T left, T right, Status*) {
+    return (left > right || std::isnan(left)) ? left : right;
+  }
+
+  template <typename T>
+  static enable_if_integer_value<T> Call(T left, T right, Status*) {
+    return std::max(left, right);
+  }
+};
+
+struct CumulativeMinOp {
+  template <typename T>
+  static constexpr enable_if_floating_value<T> Identity() {
+    return std::numeric_limits<T>::infinity();
+  }
+
+  template <typename T>
+  static constexpr enable_if_integer_value<T> Identity() {
+    return std::numeric_limits<T>::max();
+  }
+
+  template <typename T>
+  static enable_if_floating_value<T> Call(T left, T right, Status*) {
+    return (left < right || std::isnan(left)) ? left : right;
+  }
+
+  template <typename T>
+  static enable_if_integer_value<T> Call(T left, T right, Status*) {
+    return std::min(left, right);
+  }
+};
+
+// ----------------------------------------------------------------------
+// Kernel implementation
+
+// The running value is kept in the kernel state so that it carries over from one
+// chunk (or exec batch) to the next.
+template <typename ArgType, typename Op>
+struct CumulativeState : public KernelState {
+  using CType = typename TypeTraits<ArgType>::CType;
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext*,
+                                                   const KernelInitArgs& args) {
+    const auto* options = static_cast<const CumulativeOptions*>(args.options);
+    if (options == nullptr) {
+      return Status::Invalid(
+          "Attempted to run cumulative function without CumulativeOptions");
+    }
+    auto state = ::arrow::internal::make_unique<CumulativeState>();
+    state->skip_nulls = options->skip_nulls;
+    if (options->start != nullptr && options->start->is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto start, options->start->CastTo(args.inputs[0].type));
+      state->current = UnboxScalar<ArgType>::Unbox(*start);
+    }
+    return std::move(state);
+  }
+
+  CType current = Op::template Identity<CType>();
+  bool skip_nulls = false;
+  // Whether a null was seen with skip_nulls=false, making all further outputs null
+  bool encountered_null = false;
+};
+
+template <typename ArgType, typename Op>
+struct CumulativeKernel {
+  using CType = typename TypeTraits<ArgType>::CType;
+  using State = CumulativeState<ArgType, Op>;
+
+  // Each output depends on the previous one, so this is a plain sequential scan.
+  static CType Accumulate(const CType* values, CType* out, int64_t length,
+                          CType current, Status* st) {
+    for (int64_t i = 0; i < length; ++i) {
+      current = Op::template Call<CType>(current, values[i], st);
+      out[i] = current;
+    }
+    return current;
+  }
+
+  static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    const ArrayData& input = *batch[0].array();
+    ArrayData* output = out->mutable_array();
+
+    const int64_t length = input.length;
+    const CType* values = input.GetValues<CType>(1);
+    CType* out_values = output->GetMutableValues<CType>(1);
+    uint8_t* out_bitmap = output->buffers[0]->mutable_data();
+    Status st;
+
+    if (state->encountered_null) {
+      std::fill(out_values, out_values + length, CType(0));
+      bit_util::SetBitsTo(out_bitmap, output->offset, length, false);
+      output->null_count = length;
+    } else if (!input.MayHaveNulls()) {
+      state->current = Accumulate(values, out_values, length, state->current, &st);
+      bit_util::SetBitsTo(out_bitmap, output->offset, length, true);
+      output->null_count = 0;
+    } else if (state->skip_nulls) {
+      // Null slots repeat the running value
+      int64_t position = 0;
+      arrow::internal::VisitSetBitRunsVoid(
+          input.buffers[0], input.offset, length,
+          [&](int64_t run_start, int64_t run_length) {
+            std::fill(out_values + position, out_values + run_start, state->current);
+            state->current = Accumulate(values + run_start, out_values + run_start,
+                                        run_length, state->current, &st);
+            position = run_start + run_length;
+          });
+      std::fill(out_values + position, out_values + length, state->current);
+      arrow::internal::CopyBitmap(input.buffers[0]->data(), input.offset, length,
+                                  out_bitmap, output->offset);
+      output->null_count = input.GetNullCount();
+    } else {
+      // Only the leading run of valid values is accumulated, the first null
+      // makes the rest of the output null
+      arrow::internal::SetBitRunReader reader(input.buffers[0]->data(), input.offset,
+                                              length);
+      const auto run = reader.NextRun();
+      const int64_t valid_length = run.position == 0 ? run.length : 0;
+      state->current = Accumulate(values, out_values, valid_length, state->current, &st);
+      std::fill(out_values + valid_length, out_values + length, CType(0));
+      bit_util::SetBitsTo(out_bitmap, output->offset, valid_length, true);
+      bit_util::SetBitsTo(out_bitmap, output->offset + valid_length,
+                          length - valid_length, false);
+      output->null_count = length - valid_length;
+      state->encountered_null = valid_length < length;
+    }
+    return st;
+  }
+};
+
+template <typename Op>
+struct CumulativeKernelFactory {
+  VectorKernel kernel;
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cumulative kernel not implemented for type ",
+                                  type.ToString());
+  }
+
+  template <typename Type>
+  enable_if_integer<Type, Status> Visit(const Type&) {
+    return SetKernel<Type>();
+  }
+
+  template <typename Type>
+  enable_if_physical_floating_point<Type, Status> Visit(const Type&) {
+    return SetKernel<Type>();
+  }
+
+  template <typename Type>
+  Status SetKernel() {
+    kernel.init = CumulativeState<Type, Op>::Init;
+    kernel.exec = CumulativeKernel<Type, Op>::Exec;
+    return Status::OK();
+  }
+};
+
+template <typename Op>
+void MakeVectorCumulativeFunction(FunctionRegistry* registry, const std::string& name,
+                                  const FunctionDoc* doc) {
+  static const auto kDefaultOptions = CumulativeOptions::Defaults();
+  auto func = std::make_shared<VectorFunction>(name, Arity::Unary(), doc,
+                                               &kDefaultOptions);
+
+  for (const auto& ty : NumericTypes()) {
+    CumulativeKernelFactory<Op> factory;
+    DCHECK_OK(VisitTypeInline(*ty, &factory));
+    VectorKernel kernel = std::move(factory.kernel);
+    kernel.can_execute_chunkwise = true;
+    kernel.null_handling = NullHandling::type::COMPUTED_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::type::PREALLOCATE;
+    kernel.signature = KernelSignature::Make({InputType::Array(ty)}, OutputType(ty));
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+const FunctionDoc cumulative_sum_doc(
+    "Compute the cumulative sum over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative sum computed over `values`. Results will wrap around on\n"
+     "integer overflow. Use function \"cumulative_sum_checked\" if you want\n"
+     "overflow to return an error."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_sum_checked_doc(
+    "Compute the cumulative sum over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative sum computed over `values`. This function returns an error\n"
+     "on overflow. For a variant that doesn't fail on overflow, use\n"
+     "function \"cumulative_sum\"."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_prod_doc(
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative product computed over `values`. Results will wrap around on\n"
+     "integer overflow. Use function \"cumulative_prod_checked\" if you want\n"
+     "overflow to return an error."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_prod_checked_doc(
+    "Compute the cumulative product over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative product computed over `values`. This function returns an error\n"
+     "on overflow. For a variant that doesn't fail on overflow, use\n"
+     "function \"cumulative_prod\"."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_max_doc(
+    "Compute the cumulative max over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative max computed over `values`. NaN is propagated."),
+    {"values"}, "CumulativeOptions");
+
+const FunctionDoc cumulative_min_doc(
+    "Compute the cumulative min over a numeric input",
+    ("`values` must be numeric. Return an array/chunked array which is the\n"
+     "cumulative min computed over `values`. NaN is propagated."),
+    {"values"}, "CumulativeOptions");
+
+}  // namespace
+
+void RegisterVectorCumulativeOps(FunctionRegistry* registry) {
+  MakeVectorCumulativeFunction<CumulativeSumOp>(registry, "cumulative_sum",
+                                                &cumulative_sum_doc);
+  MakeVectorCumulativeFunction<CumulativeSumCheckedOp>(
+      registry, "cumulative_sum_checked", &cumulative_sum_checked_doc);
+  MakeVectorCumulativeFunction<CumulativeProdOp>(registry, "cumulative_prod",
+                                                 &cumulative_prod_doc);
+  MakeVectorCumulativeFunction<CumulativeProdCheckedOp>(
+      registry, "cumulative_prod_checked", &cumulative_prod_checked_doc);
+  MakeVectorCumulativeFunction<CumulativeMaxOp>(registry, "cumulative_max",
+                                                &cumulative_max_doc);
+  MakeVectorCumulativeFunction<CumulativeMinOp>(registry, "cumulative_min",
+                                                &cumulative_min_doc);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
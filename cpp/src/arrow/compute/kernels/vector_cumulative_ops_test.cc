@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+TEST(TestCumulativeOps, NoInput) {
+  CumulativeOptions options;
+  for (const std::string func : {"cumulative_sum", "cumulative_sum_checked",
+                                 "cumulative_prod", "cumulative_prod_checked",
+                                 "cumulative_max", "cumulative_min"}) {
+    for (const auto& ty : NumericTypes()) {
+      CheckVectorUnary(func, ArrayFromJSON(ty, "[]"), ArrayFromJSON(ty, "[]"), &options);
+      CheckVectorUnary(func, ChunkedArrayFromJSON(ty, {"[]", "[]"}),
+                       ChunkedArrayFromJSON(ty, {"[]", "[]"}), &options);
+    }
+  }
+}
+
+TEST(TestCumulativeOps, Basic) {
+  CumulativeOptions options;
+  for (const auto& ty : NumericTypes()) {
+    auto values = ArrayFromJSON(ty, "[1, 2, 3, 4, 5]");
+    CheckVectorUnary("cumulative_sum", values,
+                     ArrayFromJSON(ty, "[1, 3, 6, 10, 15]"), &options);
+    CheckVectorUnary("cumulative_sum_checked", values,
+                     ArrayFromJSON(ty, "[1, 3, 6, 10, 15]"), &options);
+    CheckVectorUnary("cumulative_prod", values,
+                     ArrayFromJSON(ty, "[1, 2, 6, 24, 120]"), &options);
+    CheckVectorUnary("cumulative_prod_checked", values,
+                     ArrayFromJSON(ty, "[1, 2, 6, 24, 120]"), &options);
+
+    values = ArrayFromJSON(ty, "[3, 1, 4, 1, 5, 9, 2]");
+    CheckVectorUnary("cumulative_max", values,
+                     ArrayFromJSON(ty, "[3, 3, 4, 4, 5, 9, 9]"), &options);
+    CheckVectorUnary("cumulative_min", values,
+                     ArrayFromJSON(ty, "[3, 1, 1, 1, 1, 1, 1]"), &options);
+  }
+}
+
+TEST(TestCumulativeOps, Start) {
+  for (const auto& ty : NumericTypes()) {
+    auto values = ArrayFromJSON(ty, "[1, 2, 3]");
+    CumulativeOptions options(ScalarFromJSON(ty, "10"));
+    CheckVectorUnary("cumulative_sum", values, ArrayFromJSON(ty, "[11, 13, 16]"),
+                     &options);
+    CheckVectorUnary("cumulative_prod", values, ArrayFromJSON(ty, "[10, 20, 60]"),
+                     &options);
+    CheckVectorUnary("cumulative_max", values, ArrayFromJSON(ty, "[10, 10, 10]"),
+                     &options);
+    CheckVectorUnary("cumulative_min", values, ArrayFromJSON(ty, "[1, 1, 1]"),
+                     &options);
+
+    // The start value is cast to the input type
+    options.start = ScalarFromJSON(int8(), "10");
+    CheckVectorUnary("cumulative_sum", values, ArrayFromJSON(ty, "[11, 13, 16]"),
+                     &options);
+
+    // A null start means the identity of the operation
+    options.start = ScalarFromJSON(ty, "null");
+    CheckVectorUnary("cumulative_sum", values, ArrayFromJSON(ty, "[1, 3, 6]"),
+                     &options);
+  }
+}
+
+TEST(TestCumulativeOps, Nulls) {
+  for (const auto& ty : NumericTypes()) {
+    auto values = ArrayFromJSON(ty, "[1, 2, null, 4, null, 6]");
+
+    CumulativeOptions options(/*skip_nulls=*/false);
+    CheckVectorUnary("cumulative_sum", values,
+                     ArrayFromJSON(ty, "[1, 3, null, null, null, null]"), &options);
+    CheckVectorUnary("cumulative_max", values,
+                     ArrayFromJSON(ty, "[1, 2, null, null, null, null]"), &options);
+    CheckVectorUnary("cumulative_sum", ArrayFromJSON(ty, "[null, 1]"),
+                     ArrayFromJSON(ty, "[null, null]"), &options);
+
+    options.skip_nulls = true;
+    CheckVectorUnary("cumulative_sum", values,
+                     ArrayFromJSON(ty, "[1, 3, null, 7, null, 13]"), &options);
+    CheckVectorUnary("cumulative_prod", values,
+                     ArrayFromJSON(ty, "[1, 2, null, 8, null, 48]"), &options);
+    CheckVectorUnary("cumulative_min", values,
+                     ArrayFromJSON(ty, "[1, 1, null, 1, null, 1]"), &options);
+    CheckVectorUnary("cumulative_sum", ArrayFromJSON(ty, "[null, null]"),
+                     ArrayFromJSON(ty, "[null, null]"), &options);
+  }
+}
+
+TEST(TestCumulativeOps, ChunkedArray) {
+  for (const auto& ty : NumericTypes()) {
+    // The running value carries over from one chunk to the next
+    auto values = ChunkedArrayFromJSON(ty, {"[1, 2]", "[]", "[3, 4]", "[5]"});
+    CumulativeOptions options;
+    CheckVectorUnary("cumulative_sum", values,
+                     ChunkedArrayFromJSON(ty, {"[1, 3]", "[]", "[6, 10]", "[15]"}),
+                     &options);
+    CheckVectorUnary("cumulative_min", ChunkedArrayFromJSON(ty, {"[5, 3]", "[4, 1]"}),
+                     ChunkedArrayFromJSON(ty, {"[5, 3]", "[3, 1]"}), &options);
+
+    // A null propagates into the following chunks unless skipped
+    values = ChunkedArrayFromJSON(ty, {"[1, null]", "[2, 3]"});
+    CheckVectorUnary("cumulative_sum", values,
+                     ChunkedArrayFromJSON(ty, {"[1, null]", "[null, null]"}), &options);
+    options.skip_nulls = true;
+    CheckVectorUnary("cumulative_sum", values,
+                     ChunkedArrayFromJSON(ty, {"[1, null]", "[3, 6]"}), &options);
+  }
+}
+
+TEST(TestCumulativeOps, Overflow) {
+  CumulativeOptions options;
+  auto values = ArrayFromJSON(int8(), "[100, 100, -100]");
+  CheckVectorUnary("cumulative_sum", values, ArrayFromJSON(int8(), "[100, -56, 100]"),
+                   &options);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("overflow"),
+      CumulativeSum(values, options, /*check_overflow=*/true));
+
+  values = ArrayFromJSON(uint8(), "[16, 16, 2]");
+  CheckVectorUnary("cumulative_prod", values, ArrayFromJSON(uint8(), "[16, 0, 0]"),
+                   &options);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("overflow"),
+      CumulativeProd(values, options, /*check_overflow=*/true));
+
+  // Overflow past the first null is not reported since those values aren't computed
+  values = ArrayFromJSON(int8(), "[100, null, 100]");
+  ASSERT_OK(CumulativeSum(values, options, /*check_overflow=*/true));
+}
+
+TEST(TestCumulativeOps, FloatingPoint) {
+  CumulativeOptions options;
+  const auto equal_options = EqualOptions().nans_equal(true);
+  for (const auto& ty : {float32(), float64()}) {
+    auto values = ArrayFromJSON(ty, "[1.5, NaN, 2.5]");
+    auto expected = ArrayFromJSON(ty, "[1.5, NaN, NaN]");
+    for (const std::string func :
+         {"cumulative_sum", "cumulative_max", "cumulative_min"}) {
+      ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, {values}, &options));
+      AssertArraysEqual(*expected, *actual.make_array(), /*verbose=*/true, equal_options);
+    }
+    CheckVectorUnary("cumulative_max", ArrayFromJSON(ty, "[-Inf, -1.5]"),
+                     ArrayFromJSON(ty, "[-Inf, -1.5]"), &options);
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
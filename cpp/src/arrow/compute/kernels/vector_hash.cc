@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
 #include <mutex>
 
@@ -28,8 +29,11 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -59,6 +63,7 @@ class UniqueAction final : public ActionBase {
   using ActionBase::ActionBase;
 
   static constexpr bool with_error_status = false;
+  static constexpr bool can_merge_memo_tables = true;
 
   UniqueAction(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
                MemoryPool* pool)
@@ -95,6 +100,7 @@ class ValueCountsAction final : ActionBase {
   using ActionBase::ActionBase;
 
   static constexpr bool with_error_status = true;
+  static constexpr bool can_merge_memo_tables = false;
 
   ValueCountsAction(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
                     MemoryPool* pool)
@@ -167,6 +173,7 @@ class DictEncodeAction final : public ActionBase {
   using ActionBase::ActionBase;
 
   static constexpr bool with_error_status = false;
+  static constexpr bool can_merge_memo_tables = true;
 
   DictEncodeAction(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
                    MemoryPool* pool)
@@ -225,6 +232,9 @@ class DictEncodeAction final : public ActionBase {
   DictionaryEncodeOptions encode_options_;
 };
 
+// Minimum length of the input slices hashed on separate threads
+constexpr int64_t kMinHashSliceLength = 1 << 16;
+
 class HashKernel : public KernelState {
  public:
   HashKernel() : options_(nullptr) {}
@@ -252,9 +262,29 @@ class HashKernel : public KernelState {
   // data structures) and visit the given input with Action.
   virtual Status Append(const ArrayData& arr) = 0;
 
+  // Keep the given input to be hashed by AppendDeferred, once all inputs
+  // are known.
+  void Defer(std::shared_ptr<ArrayData> input) {
+    std::lock_guard<std::mutex> guard(lock_);
+    deferred_inputs_.push_back(std::move(input));
+  }
+
+  // Hash the inputs kept by Defer, storing into `out` the result of Flush
+  // for each of them.
+  virtual Status AppendDeferred(KernelContext* ctx, std::vector<Datum>* out) {
+    DCHECK_EQ(out->size(), deferred_inputs_.size());
+    for (size_t i = 0; i < deferred_inputs_.size(); ++i) {
+      RETURN_NOT_OK(Append(*deferred_inputs_[i]));
+      RETURN_NOT_OK(Flush(&(*out)[i]));
+    }
+    deferred_inputs_.clear();
+    return Status::OK();
+  }
+
  protected:
   const FunctionOptions* options_;
   std::mutex lock_;
+  std::vector<std::shared_ptr<ArrayData>> deferred_inputs_;
 };
 
 // ----------------------------------------------------------------------
@@ -290,6 +320,124 @@ class RegularHashKernel : public HashKernel {
 
   std::shared_ptr<DataType> value_type() const override { return type_; }
 
+  Status AppendDeferred(KernelContext* ctx, std::vector<Datum>* out) override {
+    return DoAppendDeferred(ctx, out);
+  }
+
+  template <bool CanMerge = Action::can_merge_memo_tables>
+  enable_if_t<!CanMerge, Status> DoAppendDeferred(KernelContext* ctx,
+                                                  std::vector<Datum>* out) {
+    return HashKernel::AppendDeferred(ctx, out);
+  }
+
+  // Hash slices of the inputs into separate memo tables on the thread pool,
+  // then merge the tables in input order (which gives the same memo indices
+  // as hashing serially) and remap the flushed memo indices, if any.
+  template <bool CanMerge = Action::can_merge_memo_tables>
+  enable_if_t<CanMerge, Status> DoAppendDeferred(KernelContext* ctx,
+                                                 std::vector<Datum>* out) {
+    DCHECK_EQ(out->size(), deferred_inputs_.size());
+    ExecContext* exec_ctx = ctx->exec_context();
+    ::arrow::internal::Executor* executor = exec_ctx->executor();
+    if (executor == nullptr) {
+      executor = ::arrow::internal::GetCpuThreadPool();
+    }
+    int64_t total_length = 0;
+    for (const auto& input : deferred_inputs_) {
+      total_length += input->length;
+    }
+    if (!exec_ctx->use_threads() || executor->GetCapacity() <= 1 ||
+        total_length < 2 * kMinHashSliceLength ||
+        // Waiting on tasks from inside the executor (e.g. when the kernel runs
+        // in an exec plan) could deadlock
+        executor->OwnsThisThread()) {
+      return HashKernel::AppendDeferred(ctx, out);
+    }
+
+    // Slice lengths are a multiple of 8 so that validity bitmaps can be
+    // reassembled bytewise.
+    const int64_t slice_length = std::max(
+        kMinHashSliceLength,
+        bit_util::RoundUpToMultipleOf8(bit_util::CeilDiv(
+            total_length, static_cast<int64_t>(executor->GetCapacity()) * 4)));
+    struct Slice {
+      size_t input;
+      int64_t offset;
+      std::unique_ptr<RegularHashKernel> kernel;
+      Datum indices;
+      std::vector<int32_t> mapping;
+    };
+    std::vector<Slice> slices;
+    for (size_t i = 0; i < deferred_inputs_.size(); ++i) {
+      int64_t offset = 0;
+      do {
+        slices.push_back({i, offset, nullptr, Datum(), {}});
+        offset += slice_length;
+      } while (offset < deferred_inputs_[i]->length);
+    }
+
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(slices.size()),
+        [&](int i) {
+          Slice& slice = slices[i];
+          const ArrayData& input = *deferred_inputs_[slice.input];
+          slice.kernel.reset(new RegularHashKernel(type_, options_, pool_));
+          RETURN_NOT_OK(slice.kernel->Reset());
+          RETURN_NOT_OK(slice.kernel->Append(*input.Slice(
+              slice.offset, std::min(slice_length, input.length - slice.offset))));
+          return slice.kernel->Flush(&slice.indices);
+        },
+        executor));
+
+    for (Slice& slice : slices) {
+      RETURN_NOT_OK(memo_table_->MergeTable(*slice.kernel->memo_table_, &slice.mapping));
+      slice.kernel.reset();
+    }
+
+    if (slices[0].indices.is_array()) {
+      // The indices of an input hashed as a single slice are remapped in
+      // place, otherwise the slices write into a new array.
+      std::vector<int> num_slices(deferred_inputs_.size(), 0);
+      std::vector<int64_t> null_counts(deferred_inputs_.size(), 0);
+      for (const Slice& slice : slices) {
+        ++num_slices[slice.input];
+        null_counts[slice.input] += slice.indices.array()->null_count;
+      }
+      std::vector<std::shared_ptr<ArrayData>> outputs(deferred_inputs_.size());
+      for (const Slice& slice : slices) {
+        const size_t i = slice.input;
+        if (num_slices[i] == 1) {
+          outputs[i] = slice.indices.array();
+        } else if (slice.offset == 0) {
+          const int64_t length = deferred_inputs_[i]->length;
+          ARROW_ASSIGN_OR_RAISE(auto values,
+                                AllocateBuffer(length * sizeof(int32_t), pool_));
+          std::shared_ptr<Buffer> validity;
+          if (null_counts[i] > 0) {
+            ARROW_ASSIGN_OR_RAISE(validity, AllocateBitmap(length, pool_));
+          }
+          outputs[i] = ArrayData::Make(
+              int32(), length, {std::move(validity), std::move(values)}, null_counts[i]);
+        }
+      }
+
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          static_cast<int>(slices.size()),
+          [&](int i) {
+            const Slice& slice = slices[i];
+            RemapIndices(*slice.indices.array(), slice.mapping, slice.offset,
+                         outputs[slice.input].get());
+            return Status::OK();
+          },
+          executor));
+      for (size_t i = 0; i < outputs.size(); ++i) {
+        (*out)[i] = std::move(outputs[i]);
+      }
+    }
+    deferred_inputs_.clear();
+    return Status::OK();
+  }
+
   template <bool HasError = with_error_status>
   enable_if_t<!HasError, Status> DoAppend(const ArrayData& arr) {
     return VisitArrayDataInline<Type>(
@@ -359,6 +507,32 @@ class RegularHashKernel : public HashKernel {
  protected:
   using MemoTable = typename HashTraits<Type>::MemoTableType;
 
+  // Write the memo indices `indices` of a slice at `offset` into `out`,
+  // mapped through `mapping` to the merged memo table.
+  static void RemapIndices(const ArrayData& indices, const std::vector<int32_t>& mapping,
+                           int64_t offset, ArrayData* out) {
+    const int32_t* in_values = indices.GetValues<int32_t>(1);
+    int32_t* out_values = out->GetMutableValues<int32_t>(1, offset);
+    if (mapping.empty()) {
+      // All indices are null
+      std::fill(out_values, out_values + indices.length, 0);
+    } else {
+      const int32_t* map = mapping.data();
+      for (int64_t i = 0; i < indices.length; ++i) {
+        out_values[i] = map[in_values[i]];
+      }
+    }
+    if (out->buffers[0] && out->buffers[0] != indices.buffers[0]) {
+      uint8_t* out_validity = out->buffers[0]->mutable_data();
+      if (indices.buffers[0]) {
+        std::memcpy(out_validity + offset / 8, indices.buffers[0]->data(),
+                    bit_util::BytesForBits(indices.length));
+      } else {
+        bit_util::SetBitsTo(out_validity, offset, indices.length, true);
+      }
+    }
+  }
+
   MemoryPool* pool_;
   std::shared_ptr<DataType> type_;
   Action action_;
@@ -620,8 +794,16 @@ Status HashExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   return Status::OK();
 }
 
+// Keep the input to be hashed by the finalizer, so that all batches can be
+// hashed together (in parallel if possible)
+Status HashDeferExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  checked_cast<HashKernel*>(ctx->state())->Defer(batch[0].array());
+  return Status::OK();
+}
+
 Status UniqueFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  RETURN_NOT_OK(hash_impl->AppendDeferred(ctx, out));
   std::shared_ptr<ArrayData> uniques;
   RETURN_NOT_OK(hash_impl->GetDictionary(&uniques));
   *out = {Datum(uniques)};
@@ -630,6 +812,7 @@ Status UniqueFinalize(KernelContext* ctx, std::vector<Datum>* out) {
 
 Status DictEncodeFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  RETURN_NOT_OK(hash_impl->AppendDeferred(ctx, out));
   std::shared_ptr<ArrayData> uniques;
   RETURN_NOT_OK(hash_impl->GetDictionary(&uniques));
   auto dict_type = dictionary(int32(), uniques->type);
@@ -751,7 +934,7 @@ const FunctionDoc dictionary_encode_doc(
 
 void RegisterVectorHash(FunctionRegistry* registry) {
   VectorKernel base;
-  base.exec = HashExec;
+  base.exec = HashDeferExec;
 
   // ----------------------------------------------------------------------
   // unique
@@ -773,6 +956,7 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   // value_counts
 
+  base.exec = HashExec;
   base.finalize = ValueCountsFinalize;
   auto value_counts =
       std::make_shared<VectorFunction>("value_counts", Arity::Unary(), &value_counts_doc);
@@ -791,6 +975,7 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   // dictionary_encode
 
+  base.exec = HashDeferExec;
   base.finalize = DictEncodeFinalize;
   // Unique and ValueCounts output unchunked arrays
   base.output_chunked = true;
@@ -33,13 +33,17 @@
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
@@ -696,6 +700,68 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   AssertChunkedEqual(*dict_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestHashKernel, ParallelChunkedArray) {
+  // Large enough for the chunks to be hashed in several slices
+  random::RandomArrayGenerator rng(42);
+  ASSERT_OK_AND_ASSIGN(
+      auto strings,
+      ChunkedArray::Make({rng.String(200000, 0, 3, 0.1), rng.String(1000, 0, 3, 0.5),
+                          rng.String(0, 0, 3, 0.1), rng.String(150000, 0, 3, 0.0)}));
+  ASSERT_OK_AND_ASSIGN(
+      auto ints, ChunkedArray::Make({rng.Int64(100000, -500, 500, 1.0),
+                                     rng.Int64(300000, -50000, 50000, 0.2)}));
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  for (const auto& input : {strings, ints}) {
+    ARROW_SCOPED_TRACE(input->type()->ToString());
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("unique", {input}, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("unique", {input}, &parallel_ctx));
+    AssertDatumsEqual(expected, actual);
+
+    for (auto null_encoding :
+         {DictionaryEncodeOptions::MASK, DictionaryEncodeOptions::ENCODE}) {
+      DictionaryEncodeOptions options(null_encoding);
+      ASSERT_OK_AND_ASSIGN(
+          expected, CallFunction("dictionary_encode", {input}, &options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(
+          actual, CallFunction("dictionary_encode", {input}, &options, &parallel_ctx));
+      ValidateOutput(actual);
+      AssertDatumsEqual(expected, actual);
+    }
+  }
+}
+
+TEST_F(TestHashKernel, ParallelChunkedArrayFromExecutorThread) {
+  // When every thread of the executor calls the kernel, the kernel must not
+  // wait for tasks on that same executor
+  random::RandomArrayGenerator rng(42);
+  ASSERT_OK_AND_ASSIGN(auto input,
+                       ChunkedArray::Make({rng.Int64(200000, -500, 500, 0.1),
+                                           rng.Int64(200000, -500, 500, 0.1)}));
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("unique", {input}, &serial_ctx));
+
+  constexpr int kNumThreads = 2;
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(kNumThreads));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  std::vector<Future<Datum>> futures;
+  for (int i = 0; i < kNumThreads; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future, thread_pool->Submit([&]() {
+      return CallFunction("unique", {input}, &parallel_ctx);
+    }));
+    futures.push_back(std::move(future));
+  }
+  for (auto& future : futures) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(Datum actual, future);
+    AssertDatumsEqual(expected, actual);
+  }
+}
+
 TEST_F(TestHashKernel, ZeroLengthDictionaryEncode) {
   // ARROW-7008
   auto values = ArrayFromJSON(utf8(), "[]");
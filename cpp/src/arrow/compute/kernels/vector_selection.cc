@@ -27,6 +27,7 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
@@ -1996,6 +1997,293 @@ Result<std::shared_ptr<Array>> TakeAA(const Array& values, const Array& indices,
   return result.make_array();
 }
 
+// ----------------------------------------------------------------------
+// Take from a ChunkedArray without concatenating its chunks
+
+template <typename ValueCType>
+struct ChunkedTakeValue {
+  static void Copy(const PrimitiveArg& chunk, int64_t index, uint8_t* out,
+                   int64_t position) {
+    reinterpret_cast<ValueCType*>(out)[position] =
+        reinterpret_cast<const ValueCType*>(chunk.data)[index];
+  }
+  static void Zero(uint8_t* out, int64_t position) {
+    reinterpret_cast<ValueCType*>(out)[position] = ValueCType{};
+  }
+};
+
+template <>
+struct ChunkedTakeValue<bool> {
+  static void Copy(const PrimitiveArg& chunk, int64_t index, uint8_t* out,
+                   int64_t position) {
+    bit_util::SetBitTo(out, position, bit_util::GetBit(chunk.data, chunk.offset + index));
+  }
+  static void Zero(uint8_t* out, int64_t position) { bit_util::ClearBit(out, position); }
+};
+
+/// \brief Take fixed-width values straight out of the chunk each index
+/// resolves to, writing into a freshly allocated (zero-offset) output.
+///
+/// This function assumes that the indices have been boundschecked.
+template <typename IndexCType, typename ValueCType>
+struct ChunkedPrimitiveTakeImpl {
+  static void Exec(const std::vector<PrimitiveArg>& chunks, const ChunkResolver& resolver,
+                   const PrimitiveArg& indices, ArrayData* out_arr) {
+    using Value = ChunkedTakeValue<ValueCType>;
+    auto indices_data = reinterpret_cast<const IndexCType*>(indices.data);
+    auto out = out_arr->buffers[1]->mutable_data();
+    auto out_is_valid = out_arr->buffers[0]->mutable_data();
+
+    int64_t valid_count = 0;
+    auto PlaceValue = [&](const ChunkLocation& loc, int64_t position) {
+      const PrimitiveArg& chunk = chunks[loc.chunk_index];
+      if (chunk.null_count == 0 ||
+          bit_util::GetBit(chunk.is_valid, chunk.offset + loc.index_in_chunk)) {
+        Value::Copy(chunk, loc.index_in_chunk, out, position);
+        bit_util::SetBit(out_is_valid, position);
+        ++valid_count;
+      } else {
+        Value::Zero(out, position);
+        bit_util::ClearBit(out_is_valid, position);
+      }
+    };
+    auto PlaceNull = [&](int64_t position) {
+      Value::Zero(out, position);
+      bit_util::ClearBit(out_is_valid, position);
+    };
+
+    // Runs of valid indices are resolved a batch at a time
+    constexpr int64_t kResolveBatchSize = 64;
+    ChunkLocation locations[kResolveBatchSize];
+
+    OptionalBitBlockCounter indices_bit_counter(indices.is_valid, indices.offset,
+                                                indices.length);
+    int64_t position = 0;
+    while (position < indices.length) {
+      BitBlockCount block = indices_bit_counter.NextBlock();
+      if (block.popcount == block.length) {
+        const int64_t block_end = position + block.length;
+        while (position < block_end) {
+          const int64_t batch_size = std::min(kResolveBatchSize, block_end - position);
+          resolver.ResolveMany(batch_size, indices_data + position, locations);
+          for (int64_t i = 0; i < batch_size; ++i) {
+            PlaceValue(locations[i], position++);
+          }
+        }
+      } else if (block.popcount > 0) {
+        for (int64_t i = 0; i < block.length; ++i) {
+          if (bit_util::GetBit(indices.is_valid, indices.offset + position)) {
+            PlaceValue(resolver.Resolve(static_cast<int64_t>(indices_data[position])),
+                       position);
+            ++position;
+          } else {
+            PlaceNull(position++);
+          }
+        }
+      } else {
+        for (int64_t i = 0; i < block.length; ++i) {
+          PlaceNull(position++);
+        }
+      }
+    }
+    out_arr->null_count = out_arr->length - valid_count;
+  }
+};
+
+template <typename ValueCType>
+void ChunkedTakeIndexDispatch(const std::vector<PrimitiveArg>& chunks,
+                              const ChunkResolver& resolver, const PrimitiveArg& indices,
+                              ArrayData* out) {
+  // As in TakeIndexDispatch, boundschecked indices can be read as unsigned
+  switch (indices.bit_width) {
+    case 8:
+      return ChunkedPrimitiveTakeImpl<uint8_t, ValueCType>::Exec(chunks, resolver,
+                                                                 indices, out);
+    case 16:
+      return ChunkedPrimitiveTakeImpl<uint16_t, ValueCType>::Exec(chunks, resolver,
+                                                                  indices, out);
+    case 32:
+      return ChunkedPrimitiveTakeImpl<uint32_t, ValueCType>::Exec(chunks, resolver,
+                                                                  indices, out);
+    case 64:
+      return ChunkedPrimitiveTakeImpl<uint64_t, ValueCType>::Exec(chunks, resolver,
+                                                                  indices, out);
+    default:
+      DCHECK(false) << "Invalid indices byte width";
+      break;
+  }
+}
+
+bool CanChunkedPrimitiveTake(const DataType& type) {
+  if (!is_primitive(type.id())) {
+    return false;
+  }
+  switch (GetBitWidth(type)) {
+    case 1:
+    case 8:
+    case 16:
+    case 32:
+    case 64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+Result<std::shared_ptr<Array>> ChunkedPrimitiveTake(const ChunkedArray& values,
+                                                    const Array& indices,
+                                                    ExecContext* ctx) {
+  std::vector<PrimitiveArg> chunks;
+  chunks.reserve(values.num_chunks());
+  for (const auto& chunk : values.chunks()) {
+    chunks.push_back(GetPrimitiveArg(*chunk->data()));
+  }
+  const ChunkResolver& resolver = values.chunk_resolver();
+  const PrimitiveArg index_arg = GetPrimitiveArg(*indices.data());
+
+  const int64_t length = indices.length();
+  const int bit_width = GetBitWidth(*values.type());
+  std::vector<std::shared_ptr<Buffer>> buffers(2);
+  ARROW_ASSIGN_OR_RAISE(buffers[0], AllocateBitmap(length, ctx->memory_pool()));
+  if (bit_width == 1) {
+    ARROW_ASSIGN_OR_RAISE(buffers[1], AllocateBitmap(length, ctx->memory_pool()));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(buffers[1],
+                          AllocateBuffer(length * bit_width / 8, ctx->memory_pool()));
+  }
+  auto out = ArrayData::Make(values.type(), length, std::move(buffers));
+
+  switch (bit_width) {
+    case 1:
+      ChunkedTakeIndexDispatch<bool>(chunks, resolver, index_arg, out.get());
+      break;
+    case 8:
+      ChunkedTakeIndexDispatch<int8_t>(chunks, resolver, index_arg, out.get());
+      break;
+    case 16:
+      ChunkedTakeIndexDispatch<int16_t>(chunks, resolver, index_arg, out.get());
+      break;
+    case 32:
+      ChunkedTakeIndexDispatch<int32_t>(chunks, resolver, index_arg, out.get());
+      break;
+    case 64:
+      ChunkedTakeIndexDispatch<int64_t>(chunks, resolver, index_arg, out.get());
+      break;
+    default:
+      DCHECK(false) << "Invalid values byte width";
+      break;
+  }
+  return MakeArray(std::move(out));
+}
+
+template <typename IndexCType>
+void ResolveTakeIndices(const PrimitiveArg& indices, const ChunkResolver& resolver,
+                        ChunkLocation* out) {
+  auto indices_data = reinterpret_cast<const IndexCType*>(indices.data);
+  // The values behind null indices are resolved too (to some arbitrary
+  // location) and then overwritten
+  resolver.ResolveMany(indices.length, indices_data, out);
+  if (indices.null_count != 0) {
+    for (int64_t i = 0; i < indices.length; ++i) {
+      if (!bit_util::GetBit(indices.is_valid, indices.offset + i)) {
+        out[i] = {-1, 0};
+      }
+    }
+  }
+}
+
+// Take values of any type from a multi-chunk array: the indices are grouped by
+// the chunk they fall in, each chunk is taken from separately, and the pieces
+// (whose total size is bounded by the output) are put back in the requested
+// order by a final take.
+Result<std::shared_ptr<Array>> ChunkedGroupedTake(const ChunkedArray& values,
+                                                  const Array& indices,
+                                                  ExecContext* ctx) {
+  const int num_chunks = values.num_chunks();
+  const int64_t length = indices.length();
+  const ChunkResolver& resolver = values.chunk_resolver();
+
+  std::vector<ChunkLocation> locations(length);
+  const PrimitiveArg index_arg = GetPrimitiveArg(*indices.data());
+  // Boundschecked indices can be read as unsigned
+  switch (index_arg.bit_width) {
+    case 8:
+      ResolveTakeIndices<uint8_t>(index_arg, resolver, locations.data());
+      break;
+    case 16:
+      ResolveTakeIndices<uint16_t>(index_arg, resolver, locations.data());
+      break;
+    case 32:
+      ResolveTakeIndices<uint32_t>(index_arg, resolver, locations.data());
+      break;
+    default:
+      ResolveTakeIndices<uint64_t>(index_arg, resolver, locations.data());
+      break;
+  }
+
+  // Counting sort of the index positions by chunk
+  std::vector<int64_t> chunk_starts(num_chunks + 1, 0);
+  for (const auto& loc : locations) {
+    if (loc.chunk_index >= 0) {
+      ++chunk_starts[loc.chunk_index + 1];
+    }
+  }
+  for (int c = 0; c < num_chunks; ++c) {
+    chunk_starts[c + 1] += chunk_starts[c];
+  }
+  const int64_t num_taken = chunk_starts[num_chunks];
+  if (num_taken == 0) {
+    return MakeArrayOfNull(values.type(), length, ctx->memory_pool());
+  }
+
+  // `local_indices` holds the indices within each chunk, grouped by chunk;
+  // `ranks` holds, for each output position, where its value lands in the
+  // concatenation of the per-chunk results. `ranks` shares the validity bitmap
+  // (and hence the offset) of `indices`.
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> local_indices,
+                        AllocateBuffer(num_taken * sizeof(int64_t), ctx->memory_pool()));
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> ranks,
+      AllocateBuffer((indices.offset() + length) * sizeof(int64_t), ctx->memory_pool()));
+  auto local_data = reinterpret_cast<int64_t*>(local_indices->mutable_data());
+  auto rank_data = reinterpret_cast<int64_t*>(ranks->mutable_data()) + indices.offset();
+  std::fill(rank_data - indices.offset(), rank_data, 0);
+  std::vector<int64_t> next_slot(chunk_starts.begin(), chunk_starts.end() - 1);
+  for (int64_t i = 0; i < length; ++i) {
+    const ChunkLocation& loc = locations[i];
+    if (loc.chunk_index >= 0) {
+      const int64_t slot = next_slot[loc.chunk_index]++;
+      local_data[slot] = loc.index_in_chunk;
+      rank_data[i] = slot;
+    } else {
+      rank_data[i] = 0;
+    }
+  }
+
+  const auto no_boundscheck = TakeOptions::NoBoundsCheck();
+  ArrayVector pieces;
+  for (int c = 0; c < num_chunks; ++c) {
+    const int64_t start = chunk_starts[c];
+    const int64_t count = chunk_starts[c + 1] - start;
+    if (count == 0) continue;
+    Int64Array chunk_indices(count, SliceBuffer(local_indices, start * sizeof(int64_t),
+                                                count * sizeof(int64_t)));
+    ARROW_ASSIGN_OR_RAISE(auto piece,
+                          TakeAA(*values.chunk(c), chunk_indices, no_boundscheck, ctx));
+    pieces.push_back(std::move(piece));
+  }
+  std::shared_ptr<Array> taken;
+  if (pieces.size() == 1) {
+    taken = std::move(pieces[0]);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(taken, Concatenate(pieces, ctx->memory_pool()));
+  }
+
+  Int64Array rank_indices(length, std::move(ranks), indices.data()->buffers[0],
+                          indices.null_count(), indices.offset());
+  return TakeAA(*taken, rank_indices, no_boundscheck, ctx);
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
@@ -2007,13 +2295,20 @@ Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
   // Case 1: `values` has a single chunk, so just use it
   if (num_chunks == 1) {
     current_chunk = values.chunk(0);
+  } else if (num_chunks > 1 && is_integer(indices.type_id())) {
+    // Case 2: resolve the indices against the chunks, rather than concatenating
+    // all of `values` to take a (possibly small) subset of it
+    if (options.boundscheck) {
+      RETURN_NOT_OK(CheckIndexBounds(*indices.data(), values.length()));
+    }
+    if (CanChunkedPrimitiveTake(*values.type())) {
+      ARROW_ASSIGN_OR_RAISE(new_chunks[0], ChunkedPrimitiveTake(values, indices, ctx));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(new_chunks[0], ChunkedGroupedTake(values, indices, ctx));
+    }
+    return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
+    // Case 3: no chunks (or invalid indices, which Array Take will report)
     if (values.chunks().empty()) {
       ARROW_ASSIGN_OR_RAISE(current_chunk, MakeArrayOfNull(values.type(), /*length=*/0,
                                                            ctx->memory_pool()));
@@ -2034,14 +2329,10 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
   for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
+    // Take with that indices chunk; TakeCA returns a single chunk
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
                           TakeCA(values, *indices.chunk(i), options, ctx));
-    // Concatenate the result to make a single array for this chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+    new_chunks[i] = current_chunk->chunk(0);
   }
   return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
 }
@@ -1669,6 +1669,41 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
   ASSERT_RAISES(IndexError, this->TakeWithChunkedArray(int8(), {"[]"}, {"[0]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArrayRandom) {
+  // Taking from several chunks must match taking from their concatenation,
+  // whether the values are fixed-width or not
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 500;
+  for (const auto& type : {boolean(), int8(), uint16(), float32(), int64(),
+                           timestamp(TimeUnit::MILLI), utf8(), list(int32())}) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto values = rand.ArrayOf(type, length, /*null_probability=*/0.2);
+    // Uneven chunks, including an empty one and some with non-zero offsets
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{values->Slice(0, 7), values->Slice(7, 0), values->Slice(7, 200),
+                    values->Slice(207, 1), values->Slice(208)},
+        type);
+    for (const auto& index_type : {int8(), uint32(), int64()}) {
+      const int64_t max_index = index_type->id() == Type::INT8 ? 127 : length - 1;
+      ASSERT_OK_AND_ASSIGN(
+          auto indices,
+          Cast(*rand.Int64(300, 0, max_index, /*null_probability=*/0.1), index_type));
+      ASSERT_OK_AND_ASSIGN(Datum expected, Take(values, indices));
+
+      ASSERT_OK_AND_ASSIGN(Datum actual, Take(chunked, indices));
+      ValidateOutput(actual);
+      AssertChunkedEqual(*actual.chunked_array(), ArrayVector{expected.make_array()});
+
+      auto chunked_indices = std::make_shared<ChunkedArray>(
+          ArrayVector{indices->Slice(0, 100), indices->Slice(100)});
+      ASSERT_OK_AND_ASSIGN(actual, Take(chunked, chunked_indices));
+      ValidateOutput(actual);
+      AssertChunkedEquivalent(ChunkedArray(expected.make_array()),
+                              *actual.chunked_array());
+    }
+  }
+}
+
 class TestTakeKernelWithTable : public TestTakeKernelTyped<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
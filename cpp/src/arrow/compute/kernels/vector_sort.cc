@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <numeric>
@@ -34,7 +35,9 @@
 #include "arrow/table.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -198,25 +201,35 @@ class ChunkedArraySorter : public TypeVisitor {
       return Status::OK();
     }
     const auto arrays = GetArrayPointers(physical_chunks_);
+    const bool parallel =
+        ParallelMerger::IsEnabled(ctx_, indices_end_ - indices_begin_) && num_chunks > 1;
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
     std::vector<NullPartitionResult> sorted(num_chunks);
 
     // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
-      const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      sorted[i] =
-          array_sorter_(indices_begin_ + begin_offset, indices_begin_ + end_offset,
-                        *array, begin_offset, options);
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
+    DCHECK_EQ(offsets[num_chunks], indices_end_ - indices_begin_);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        parallel, num_chunks,
+        [&](int i) {
+          // Array sorters may hold state, so each task gets its own
+          ArraySortFunc array_sorter = array_sorter_;
+          if (parallel) {
+            ARROW_ASSIGN_OR_RAISE(array_sorter, GetArraySorter(*physical_type_));
+          }
+          const auto array = checked_cast<const ArrayType*>(arrays[i]);
+          sorted[i] =
+              array_sorter(indices_begin_ + offsets[i], indices_begin_ + offsets[i + 1],
+                           *array, offsets[i], options);
+          return Status::OK();
+        },
+        ParallelMerger::GetExecutor(ctx_)));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -229,16 +242,29 @@ class ChunkedArraySorter : public TypeVisitor {
                                                 null_placement_);
         }
       };
+      // When running in parallel, non-null merges are deferred to the end of
+      // each round of merges
+      ParallelMerger parallel_merger(ctx_, indices_begin_, indices_end_);
       auto merge_non_nulls = [&](uint64_t* range_begin, uint64_t* range_middle,
                                  uint64_t* range_end, uint64_t* temp_indices) {
-        MergeNonNulls<ArrayType>(range_begin, range_middle, range_end, arrays,
-                                 temp_indices);
+        if (parallel) {
+          parallel_merger.Add(range_begin, range_middle, range_end);
+        } else {
+          MergeNonNulls<ArrayType>(range_begin, range_middle, range_end, arrays,
+                                   temp_indices);
+        }
+      };
+      auto make_comparator = [&]() {
+        return NonNullsComparator<ArrayType>(arrays, order_);
       };
 
       MergeImpl merge_impl{null_placement_, std::move(merge_nulls),
                            std::move(merge_non_nulls)};
       // std::merge is only called on non-null values, so size temp indices accordingly
       RETURN_NOT_OK(merge_impl.Init(ctx_, indices_end_ - indices_begin_ - null_count));
+      if (parallel) {
+        RETURN_NOT_OK(parallel_merger.Init());
+      }
 
       while (sorted.size() > 1) {
         auto out_it = sorted.begin();
@@ -254,6 +280,9 @@ class ChunkedArraySorter : public TypeVisitor {
           *out_it++ = *it++;
         }
         sorted.erase(out_it, sorted.end());
+        if (parallel) {
+          RETURN_NOT_OK(parallel_merger.Run(make_comparator));
+        }
       }
     }
 
@@ -266,30 +295,35 @@ class ChunkedArraySorter : public TypeVisitor {
     return Status::OK();
   }
 
+  // Compare non-null values.  Each instance has its own resolvers, so distinct
+  // instances may be used concurrently.
+  template <typename ArrayType>
+  struct NonNullsComparator {
+    NonNullsComparator(const std::vector<const Array*>& arrays, SortOrder order)
+        : left_resolver(arrays), right_resolver(arrays), order(order) {}
+
+    bool operator()(uint64_t left, uint64_t right) const {
+      const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
+      const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
+      if (order == SortOrder::Ascending) {
+        return chunk_left.Value() < chunk_right.Value();
+      }
+      // We don't use 'left > right' here to reduce required
+      // operator. If we use 'right < left' here, '<' is only
+      // required.
+      return chunk_right.Value() < chunk_left.Value();
+    }
+
+    ChunkedArrayResolver left_resolver;
+    ChunkedArrayResolver right_resolver;
+    SortOrder order;
+  };
+
   template <typename ArrayType>
   void MergeNonNulls(uint64_t* range_begin, uint64_t* range_middle, uint64_t* range_end,
                      const std::vector<const Array*>& arrays, uint64_t* temp_indices) {
-    const ChunkedArrayResolver left_resolver(arrays);
-    const ChunkedArrayResolver right_resolver(arrays);
-
-    if (order_ == SortOrder::Ascending) {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-                 [&](uint64_t left, uint64_t right) {
-                   const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
-                   const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
-                   return chunk_left.Value() < chunk_right.Value();
-                 });
-    } else {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-                 [&](uint64_t left, uint64_t right) {
-                   const auto chunk_left = left_resolver.Resolve<ArrayType>(left);
-                   const auto chunk_right = right_resolver.Resolve<ArrayType>(right);
-                   // We don't use 'left > right' here to reduce required
-                   // operator. If we use 'right < left' here, '<' is only
-                   // required.
-                   return chunk_right.Value() < chunk_left.Value();
-                 });
-    }
+    std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
+               NonNullsComparator<ArrayType>(arrays, order_));
     // Copy back temp area into main buffer
     std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
   }
@@ -897,8 +931,8 @@ class TableSorter {
         batches_(MakeBatches(table, &status_)),
         options_(options),
         null_placement_(options.null_placement),
-        left_resolver_(ChunkResolver::FromBatches(batches_)),
-        right_resolver_(ChunkResolver::FromBatches(batches_)),
+        left_resolver_(batches_),
+        right_resolver_(batches_),
         sort_keys_(ResolveSortKeys(table, batches_, options.sort_keys, &status_)),
         indices_begin_(indices_begin),
         indices_end_(indices_end),
@@ -948,23 +982,32 @@ class TableSorter {
     std::vector<NullPartitionResult> sorted(num_batches);
 
     // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
-    int64_t null_count = 0;
+    std::vector<int64_t> offsets(num_batches + 1, 0);
     for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + batches[i]->num_rows();
+    }
+    DCHECK_EQ(offsets[num_batches], indices_end_ - indices_begin_);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        ParallelMerger::IsEnabled(ctx_, table_.num_rows()) && num_batches > 1,
+        static_cast<int>(num_batches),
+        [&](int i) -> Status {
+          const auto& batch = *batches[i];
+          RadixRecordBatchSorter sorter(indices_begin_ + offsets[i],
+                                        indices_begin_ + offsets[i + 1], batch,
+                                        options_);
+          ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(offsets[i]));
+          DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + offsets[i]);
+          DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + offsets[i + 1]);
+          DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                    batch.num_rows());
+          return Status::OK();
+        },
+        ParallelMerger::GetExecutor(ctx_)));
+    int64_t null_count = 0;
+    for (const auto& p : sorted) {
       // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
+      null_count += p.null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -1001,14 +1044,26 @@ class TableSorter {
                            int64_t null_count) {
       MergeNulls<Type>(nulls_begin, nulls_middle, nulls_end, temp_indices, null_count);
     };
+    // When running in parallel, non-null merges are deferred to the end of
+    // each round of merges
+    const bool parallel = ParallelMerger::IsEnabled(ctx_, table_.num_rows());
+    ParallelMerger parallel_merger(ctx_, indices_begin_, indices_end_);
     auto merge_non_nulls = [&](uint64_t* range_begin, uint64_t* range_middle,
                                uint64_t* range_end, uint64_t* temp_indices) {
-      MergeNonNulls<Type>(range_begin, range_middle, range_end, temp_indices);
+      if (parallel) {
+        parallel_merger.Add(range_begin, range_middle, range_end);
+      } else {
+        MergeNonNulls<Type>(range_begin, range_middle, range_end, temp_indices);
+      }
     };
+    auto make_comparator = [&]() { return NonNullsComparator<Type>(this); };
 
     MergeImpl merge_impl(options_.null_placement, std::move(merge_nulls),
                          std::move(merge_non_nulls));
     RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
+    if (parallel) {
+      RETURN_NOT_OK(parallel_merger.Init());
+    }
 
     while (sorted.size() > 1) {
       auto out_it = sorted.begin();
@@ -1023,6 +1078,9 @@ class TableSorter {
         *out_it++ = *it++;
       }
       sorted.erase(out_it, sorted.end());
+      if (parallel) {
+        RETURN_NOT_OK(parallel_merger.Run(make_comparator));
+      }
     }
     DCHECK_EQ(sorted.size(), 1);
     DCHECK_EQ(sorted[0].overall_begin(), indices_begin_);
@@ -1091,41 +1149,74 @@ class TableSorter {
   //
   // Merge rows with a non-null in the first sort key
   //
+
+  // Each instance has its own resolvers, so distinct instances may be used
+  // concurrently.
+  template <typename Type, typename Enable = void>
+  struct NonNullsComparator {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+    explicit NonNullsComparator(TableSorter* sorter)
+        : sorter(sorter),
+          left_resolver(sorter->left_resolver_),
+          right_resolver(sorter->right_resolver_) {}
+
+    bool operator()(uint64_t left, uint64_t right) const {
+      const auto& first_sort_key = sorter->sort_keys_[0];
+      // Both values are never null nor NaN.
+      const auto left_loc = left_resolver.Resolve(left);
+      const auto right_loc = right_resolver.Resolve(right);
+      auto chunk_left = first_sort_key.template GetChunk<ArrayType>(left_loc);
+      auto chunk_right = first_sort_key.template GetChunk<ArrayType>(right_loc);
+      DCHECK(!chunk_left.IsNull());
+      DCHECK(!chunk_right.IsNull());
+      auto value_left = chunk_left.Value();
+      auto value_right = chunk_right.Value();
+      if (value_left == value_right) {
+        // If the left value equals to the right value,
+        // we need to compare the second and following
+        // sort keys.
+        return sorter->comparator_.Compare(left_loc, right_loc, 1);
+      } else {
+        auto compared = value_left < value_right;
+        if (first_sort_key.order == SortOrder::Ascending) {
+          return compared;
+        } else {
+          return !compared;
+        }
+      }
+    }
+
+    TableSorter* sorter;
+    ChunkResolver left_resolver;
+    ChunkResolver right_resolver;
+  };
+
+  template <typename Type>
+  struct NonNullsComparator<Type, enable_if_null<Type>> {
+    explicit NonNullsComparator(TableSorter* sorter)
+        : sorter(sorter),
+          left_resolver(sorter->left_resolver_),
+          right_resolver(sorter->right_resolver_) {}
+
+    bool operator()(uint64_t left, uint64_t right) const {
+      // First column is always null
+      return sorter->comparator_.Compare(left_resolver.Resolve(left),
+                                         right_resolver.Resolve(right), 1);
+    }
+
+    TableSorter* sorter;
+    ChunkResolver left_resolver;
+    ChunkResolver right_resolver;
+  };
+
   template <typename Type>
   enable_if_t<!is_null_type<Type>::value> MergeNonNulls(uint64_t* range_begin,
                                                         uint64_t* range_middle,
                                                         uint64_t* range_end,
                                                         uint64_t* temp_indices) {
-    using ArrayType = typename TypeTraits<Type>::ArrayType;
-
-    auto& comparator = comparator_;
-    const auto& first_sort_key = sort_keys_[0];
-
     std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-               [&](uint64_t left, uint64_t right) {
-                 // Both values are never null nor NaN.
-                 const auto left_loc = left_resolver_.Resolve(left);
-                 const auto right_loc = right_resolver_.Resolve(right);
-                 auto chunk_left = first_sort_key.GetChunk<ArrayType>(left_loc);
-                 auto chunk_right = first_sort_key.GetChunk<ArrayType>(right_loc);
-                 DCHECK(!chunk_left.IsNull());
-                 DCHECK(!chunk_right.IsNull());
-                 auto value_left = chunk_left.Value();
-                 auto value_right = chunk_right.Value();
-                 if (value_left == value_right) {
-                   // If the left value equals to the right value,
-                   // we need to compare the second and following
-                   // sort keys.
-                   return comparator.Compare(left_loc, right_loc, 1);
-                 } else {
-                   auto compared = value_left < value_right;
-                   if (first_sort_key.order == SortOrder::Ascending) {
-                     return compared;
-                   } else {
-                     return !compared;
-                   }
-                 }
-               });
+               NonNullsComparator<Type>(this));
     // Copy back temp area into main buffer
     std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
   }
@@ -1150,6 +1241,315 @@ class TableSorter {
   Status status_;
 };
 
+// ----------------------------------------------------------------------
+// Normalized key sorting implementation
+
+// Encode one sort key value as an order-preserving big-endian byte string, so that
+// memcmp() on encoded values orders them like the values themselves.
+template <typename Type, typename Enable = void>
+struct NormalizedKeyEncoder {};
+
+template <typename UInt>
+void PutBigEndian(UInt key, uint8_t* out) {
+  key = bit_util::ToBigEndian(key);
+  std::memcpy(out, &key, sizeof(UInt));
+}
+
+template <>
+struct NormalizedKeyEncoder<BooleanType> {
+  static void Encode(const BooleanArray& values, int64_t i, uint8_t* out) {
+    *out = values.Value(i) ? 1 : 0;
+  }
+};
+
+template <typename Type>
+struct NormalizedKeyEncoder<Type, enable_if_integer<Type>> {
+  using c_type = typename Type::c_type;
+  using Key = typename std::make_unsigned<c_type>::type;
+
+  static void Encode(const NumericArray<Type>& values, int64_t i, uint8_t* out) {
+    // Flip the sign bit so that negative values order before positive ones
+    constexpr Key kSignBit = std::is_signed<c_type>::value
+                                 ? static_cast<Key>(Key(1) << (8 * sizeof(Key) - 1))
+                                 : Key(0);
+    PutBigEndian(static_cast<Key>(static_cast<Key>(values.Value(i)) ^ kSignBit), out);
+  }
+};
+
+template <typename Type>
+struct NormalizedKeyEncoder<
+    Type, enable_if_t<is_floating_type<Type>::value &&
+                      std::is_floating_point<typename Type::c_type>::value>> {
+  using c_type = typename Type::c_type;
+  using Key = typename std::conditional<sizeof(c_type) == 4, uint32_t, uint64_t>::type;
+
+  // NaNs are encoded separately
+  static void Encode(const NumericArray<Type>& values, int64_t i, uint8_t* out) {
+    constexpr Key kSignBit = Key(1) << (8 * sizeof(Key) - 1);
+    c_type value = values.Value(i);
+    // -0.0 and 0.0 compare equal
+    if (value == 0) {
+      value = 0;
+    }
+    Key bits;
+    std::memcpy(&bits, &value, sizeof(Key));
+    PutBigEndian((bits & kSignBit) ? static_cast<Key>(~bits) : (bits | kSignBit), out);
+  }
+};
+
+template <typename Type>
+struct NormalizedKeyEncoder<Type, enable_if_decimal<Type>> {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using DecimalType = typename TypeTraits<Type>::CType;
+
+  static void Encode(const ArrayType& values, int64_t i, uint8_t* out) {
+    auto words = DecimalType(values.GetValue(i)).little_endian_array();
+    words.back() ^= uint64_t(1) << 63;
+    for (auto it = words.rbegin(); it != words.rend(); ++it, out += sizeof(uint64_t)) {
+      PutBigEndian(*it, out);
+    }
+  }
+};
+
+template <>
+struct NormalizedKeyEncoder<FixedSizeBinaryType> {
+  static void Encode(const FixedSizeBinaryArray& values, int64_t i, uint8_t* out) {
+    std::memcpy(out, values.GetValue(i), values.byte_width());
+  }
+};
+
+// Sort a record batch or table on fixed-width sort keys using normalized keys.
+//
+// The sort key values of each row are first encoded into a fixed-width byte string
+// which compares with memcmp() like the row compares across the sort keys, with
+// sort order and null placement folded in.  Rows are then sorted with a single
+// memcmp() per comparison instead of a chain of per-column comparators.
+//
+// Each sort key takes an optional leading byte ranking nulls, NaNs and other values
+// (only present if the column has nulls or is floating-point) followed by the value
+// encoded by NormalizedKeyEncoder, with its bits inverted for descending order.
+class NormalizedKeySorter {
+ public:
+  // Preprocessed sort key.
+  struct ResolvedSortKey {
+    ResolvedSortKey(const std::shared_ptr<Array>& array, SortOrder order)
+        : type(GetPhysicalType(array->type())),
+          chunks(GetPhysicalChunks(ArrayVector{array}, type)),
+          order(order),
+          null_count(array->null_count()) {}
+
+    ResolvedSortKey(const std::shared_ptr<ChunkedArray>& chunked_array,
+                    SortOrder order)
+        : type(GetPhysicalType(chunked_array->type())),
+          chunks(GetPhysicalChunks(*chunked_array, type)),
+          order(order),
+          null_count(chunked_array->null_count()) {}
+
+    std::shared_ptr<DataType> type;
+    ArrayVector chunks;
+    SortOrder order;
+    int64_t null_count;
+  };
+
+  NormalizedKeySorter(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
+                      std::vector<ResolvedSortKey> sort_keys,
+                      NullPlacement null_placement)
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        sort_keys_(std::move(sort_keys)),
+        null_placement_(null_placement) {}
+
+  // Whether all the given sort keys have a fixed-width normalized form
+  static bool CanSort(const Schema& schema, const std::vector<SortKey>& sort_keys) {
+    const auto maybe_fields = FindSortKeys(schema, sort_keys);
+    if (!maybe_fields.ok()) {
+      // Let the other sorters report the error
+      return false;
+    }
+    for (const auto& f : *maybe_fields) {
+      if (ValueWidth(*GetPhysicalType(schema.field(f.field_index)->type())) < 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Expects indices to be initialized as 0, 1, ..., n - 1
+  Status Sort() {
+    const int64_t length = indices_end_ - indices_begin_;
+    int64_t row_width = 0;
+    std::vector<int64_t> key_offsets;
+    for (const auto& sort_key : sort_keys_) {
+      key_offsets.push_back(row_width);
+      row_width += HasNullRank(sort_key) + ValueWidth(*sort_key.type);
+    }
+    if (length == 0 || row_width == 0) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto keys,
+                          AllocateBuffer(length * row_width, ctx_->memory_pool()));
+    uint8_t* keys_data = keys->mutable_data();
+    const bool parallel = ParallelMerger::IsEnabled(ctx_, length);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        parallel, static_cast<int>(sort_keys_.size()),
+        [&](int i) {
+          ColumnEncoder encoder{this, sort_keys_[i], keys_data + key_offsets[i],
+                                row_width};
+          return VisitTypeInline(*sort_keys_[i].type, &encoder);
+        },
+        ParallelMerger::GetExecutor(ctx_)));
+
+    const size_t key_width = static_cast<size_t>(row_width);
+    auto compare = [keys_data, key_width](uint64_t left, uint64_t right) {
+      return std::memcmp(keys_data + left * key_width, keys_data + right * key_width,
+                         key_width) < 0;
+    };
+    if (!parallel) {
+      std::stable_sort(indices_begin_, indices_end_, compare);
+      return Status::OK();
+    }
+
+    // Sort slices of the indices concurrently, then merge them by pairs
+    const int num_slices = ParallelMerger::NumTasks(ctx_);
+    std::vector<uint64_t*> bounds(num_slices + 1);
+    for (int i = 0; i <= num_slices; ++i) {
+      bounds[i] = indices_begin_ + i * length / num_slices;
+    }
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_slices,
+        [&](int i) {
+          std::stable_sort(bounds[i], bounds[i + 1], compare);
+          return Status::OK();
+        },
+        ParallelMerger::GetExecutor(ctx_)));
+
+    ParallelMerger merger(ctx_, indices_begin_, indices_end_);
+    RETURN_NOT_OK(merger.Init());
+    while (bounds.size() > 2) {
+      std::vector<uint64_t*> merged_bounds;
+      size_t i = 0;
+      for (; i + 2 < bounds.size(); i += 2) {
+        merger.Add(bounds[i], bounds[i + 1], bounds[i + 2]);
+        merged_bounds.push_back(bounds[i]);
+      }
+      // The last slice may be left over
+      merged_bounds.insert(merged_bounds.end(), bounds.begin() + i, bounds.end());
+      RETURN_NOT_OK(merger.Run([&]() { return compare; }));
+      bounds = std::move(merged_bounds);
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct ColumnEncoder {
+    Status Visit(const DataType& type) {
+      return Status::TypeError("Unsupported type for normalized sort key: ", type);
+    }
+
+    // All values are null, so equal
+    Status Visit(const NullType&) { return Status::OK(); }
+
+    template <typename Type>
+    decltype(&NormalizedKeyEncoder<Type>::Encode, Status()) Visit(const Type&) {
+      sorter->EncodeColumn<Type>(sort_key, out, row_width);
+      return Status::OK();
+    }
+
+    const NormalizedKeySorter* sorter;
+    const ResolvedSortKey& sort_key;
+    uint8_t* out;
+    int64_t row_width;
+  };
+
+  // Return -1 if the physical type has no fixed-width normalized form
+  static int ValueWidth(const DataType& type) {
+    switch (type.id()) {
+      case Type::NA:
+        return 0;
+      case Type::BOOL:
+        return 1;
+      case Type::UINT8:
+      case Type::INT8:
+      case Type::UINT16:
+      case Type::INT16:
+      case Type::UINT32:
+      case Type::INT32:
+      case Type::UINT64:
+      case Type::INT64:
+      case Type::FLOAT:
+      case Type::DOUBLE:
+      case Type::FIXED_SIZE_BINARY:
+      case Type::DECIMAL128:
+      case Type::DECIMAL256:
+        return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+      default:
+        return -1;
+    }
+  }
+
+  static int HasNullRank(const ResolvedSortKey& sort_key) {
+    if (sort_key.type->id() == Type::NA) {
+      return 0;
+    }
+    return (sort_key.null_count > 0 || is_floating(sort_key.type->id())) ? 1 : 0;
+  }
+
+  template <typename Type>
+  static enable_if_t<has_null_like_values<Type>::value, bool> IsNullLike(
+      const typename TypeTraits<Type>::ArrayType& values, int64_t i) {
+    return std::isnan(values.Value(i));
+  }
+
+  template <typename Type>
+  static enable_if_t<!has_null_like_values<Type>::value, bool> IsNullLike(
+      const typename TypeTraits<Type>::ArrayType& values, int64_t i) {
+    return false;
+  }
+
+  template <typename Type>
+  void EncodeColumn(const ResolvedSortKey& sort_key, uint8_t* out,
+                    int64_t row_width) const {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+    const int value_width = ValueWidth(*sort_key.type);
+    const bool has_null_rank = HasNullRank(sort_key) != 0;
+    const bool invert = sort_key.order == SortOrder::Descending;
+    // Nulls and NaNs are placed regardless of the sort order
+    const uint8_t null_rank = null_placement_ == NullPlacement::AtStart ? 0 : 2;
+    const uint8_t nan_rank = 1;
+    const uint8_t value_rank = 2 - null_rank;
+
+    for (const auto& chunk : sort_key.chunks) {
+      const auto& values = checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < values.length(); ++i, out += row_width) {
+        uint8_t* value_out = out;
+        if (has_null_rank) {
+          if (values.IsNull(i) || IsNullLike<Type>(values, i)) {
+            *out = values.IsNull(i) ? null_rank : nan_rank;
+            std::memset(out + 1, 0, value_width);
+            continue;
+          }
+          *value_out++ = value_rank;
+        }
+        NormalizedKeyEncoder<Type>::Encode(values, i, value_out);
+        if (invert) {
+          for (int j = 0; j < value_width; ++j) {
+            value_out[j] = static_cast<uint8_t>(~value_out[j]);
+          }
+        }
+      }
+    }
+  }
+
+  ExecContext* ctx_;
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  const std::vector<ResolvedSortKey> sort_keys_;
+  const NullPlacement null_placement_;
+};
+
 // ----------------------------------------------------------------------
 // Top-level sort functions
 
@@ -1263,10 +1663,18 @@ class SortIndicesMetaFunction : public MetaFunction {
 
     // Radix sorting is consistently faster except when there is a large number
     // of sort keys, in which case it can end up degrading catastrophically.
-    // Cut off above 8 sort keys.
+    // Cut off above 8 sort keys.  Past that, prefer normalized keys if all sort
+    // keys are fixed-width.
     if (n_sort_keys <= 8) {
       RadixRecordBatchSorter sorter(out_begin, out_end, batch, options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
+    } else if (NormalizedKeySorter::CanSort(*batch.schema(), options.sort_keys)) {
+      ARROW_ASSIGN_OR_RAISE(auto sort_keys,
+                            ResolveSortKeys<NormalizedKeySorter::ResolvedSortKey>(
+                                batch, options.sort_keys));
+      NormalizedKeySorter sorter(ctx, out_begin, out_end, std::move(sort_keys),
+                                 options.null_placement);
+      ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
       MultipleKeyRecordBatchSorter sorter(out_begin, out_end, batch, options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
@@ -1301,8 +1709,19 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
-    TableSorter sorter(ctx, out_begin, out_end, table, options);
-    RETURN_NOT_OK(sorter.Sort());
+    // Normalized keys avoid both the per-column comparisons and the merging of
+    // per-batch results, but are only available for fixed-width sort keys.
+    if (NormalizedKeySorter::CanSort(*table.schema(), options.sort_keys)) {
+      ARROW_ASSIGN_OR_RAISE(auto sort_keys,
+                            ResolveSortKeys<NormalizedKeySorter::ResolvedSortKey>(
+                                table, options.sort_keys));
+      NormalizedKeySorter sorter(ctx, out_begin, out_end, std::move(sort_keys),
+                                 options.null_placement);
+      RETURN_NOT_OK(sorter.Sort());
+    } else {
+      TableSorter sorter(ctx, out_begin, out_end, table, options);
+      RETURN_NOT_OK(sorter.Sort());
+    }
 
     return Datum(out);
   }
@@ -21,12 +21,17 @@
 #include <cmath>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -443,6 +448,149 @@ struct MergeImpl {
   uint64_t* temp_indices_ = nullptr;
 };
 
+// Run merges of adjacent sorted index ranges on the ExecContext's executor.
+//
+// Merges are queued with Add() and run together by Run(), which is meant to be
+// called once per round of pairwise merges.  Each merge is split along its merge
+// path (Odeh et al., "Merge Path - Parallel Merging Made Simple") into independent
+// pieces of roughly equal size, so that even the final merge of a round with a
+// single pair is spread over all threads.
+class ParallelMerger {
+ public:
+  ParallelMerger(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end)
+      : ctx_(ctx), indices_begin_(indices_begin), indices_end_(indices_end) {}
+
+  // Whether sorting `length` indices with `ctx` should use multiple threads
+  static bool IsEnabled(ExecContext* ctx, int64_t length) {
+    return ctx->use_threads() && length >= kMinParallelLength &&
+           GetExecutor(ctx)->GetCapacity() > 1 &&
+           // Waiting on tasks from inside the executor could deadlock
+           !GetExecutor(ctx)->OwnsThisThread();
+  }
+
+  static ::arrow::internal::Executor* GetExecutor(ExecContext* ctx) {
+    return ctx->executor() ? ctx->executor() : ::arrow::internal::GetCpuThreadPool();
+  }
+
+  // The number of tasks to split work into
+  static int NumTasks(ExecContext* ctx) { return GetExecutor(ctx)->GetCapacity(); }
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(
+        temp_buffer_, AllocateBuffer(sizeof(uint64_t) * (indices_end_ - indices_begin_),
+                                     ctx_->memory_pool()));
+    temp_indices_ = reinterpret_cast<uint64_t*>(temp_buffer_->mutable_data());
+    return Status::OK();
+  }
+
+  // Queue the merge of [range_begin, range_middle) and [range_middle, range_end)
+  void Add(uint64_t* range_begin, uint64_t* range_middle, uint64_t* range_end) {
+    if (range_begin != range_middle && range_middle != range_end) {
+      ranges_.push_back({range_begin, range_middle, range_end});
+    }
+  }
+
+  // Run all queued merges.  `make_comparator()` is called once per task and must
+  // return a comparator suitable for std::merge; distinct comparators may be used
+  // concurrently.
+  template <typename MakeComparator>
+  Status Run(MakeComparator&& make_comparator) {
+    int64_t total_length = 0;
+    for (const auto& range : ranges_) {
+      total_length += range.end - range.begin;
+    }
+    const int64_t piece_length =
+        std::max(int64_t{kMinPieceLength},
+                 bit_util::CeilDiv(total_length, 2 * NumTasks(ctx_)));
+
+    std::vector<Piece> pieces;
+    for (const auto& range : ranges_) {
+      const int64_t length = range.end - range.begin;
+      const int64_t num_pieces = bit_util::CeilDiv(length, piece_length);
+      for (int64_t i = 0; i < num_pieces; ++i) {
+        pieces.push_back(
+            {&range, i * length / num_pieces, (i + 1) * length / num_pieces});
+      }
+    }
+
+    auto executor = GetExecutor(ctx_);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(pieces.size()),
+        [&](int i) {
+          const auto& piece = pieces[i];
+          const auto& range = *piece.range;
+          auto comparator = make_comparator();
+          const int64_t left_begin = CoRank(range, piece.begin, comparator);
+          const int64_t left_end = CoRank(range, piece.end, comparator);
+          std::merge(range.begin + left_begin, range.begin + left_end,
+                     range.middle + (piece.begin - left_begin),
+                     range.middle + (piece.end - left_end),
+                     temp_indices_ + (range.begin - indices_begin_) + piece.begin,
+                     comparator);
+          return Status::OK();
+        },
+        executor));
+    // Copy back once all pieces have read their inputs
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(pieces.size()),
+        [&](int i) {
+          const auto& piece = pieces[i];
+          const auto temp_begin = temp_indices_ + (piece.range->begin - indices_begin_);
+          std::copy(temp_begin + piece.begin, temp_begin + piece.end,
+                    piece.range->begin + piece.begin);
+          return Status::OK();
+        },
+        executor));
+    ranges_.clear();
+    return Status::OK();
+  }
+
+ private:
+  struct Range {
+    uint64_t* begin;
+    uint64_t* middle;
+    uint64_t* end;
+  };
+
+  // Output positions [begin, end) of a merged range
+  struct Piece {
+    const Range* range;
+    int64_t begin;
+    int64_t end;
+  };
+
+  // Return how many of the first `diagonal` merged values come from the left input,
+  // given that std::merge takes from the left input on ties.
+  template <typename Comparator>
+  static int64_t CoRank(const Range& range, int64_t diagonal, Comparator& comparator) {
+    const int64_t left_length = range.middle - range.begin;
+    const int64_t right_length = range.end - range.middle;
+    int64_t lo = std::max<int64_t>(0, diagonal - right_length);
+    int64_t hi = std::min(diagonal, left_length);
+    while (lo < hi) {
+      const int64_t left = lo + (hi - lo) / 2;
+      const int64_t right = diagonal - left;
+      // Does left[left] come before right[right - 1] in the output?
+      if (right > 0 && !comparator(range.middle[right - 1], range.begin[left])) {
+        lo = left + 1;
+      } else {
+        hi = left;
+      }
+    }
+    return lo;
+  }
+
+  static constexpr int64_t kMinParallelLength = 1 << 16;
+  static constexpr int64_t kMinPieceLength = 1 << 14;
+
+  ExecContext* ctx_;
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  std::vector<Range> ranges_;
+  std::unique_ptr<Buffer> temp_buffer_;
+  uint64_t* temp_indices_ = nullptr;
+};
+
 // TODO make this usable if indices are non trivial on input
 // (see ConcreteRecordBatchColumnSorter)
 // `offset` is used when this is called on a chunk of a chunked array
@@ -19,6 +19,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -846,6 +847,89 @@ TYPED_TEST(TestArraySortIndicesRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// Long array with big value range: radix sort
+// - length >= 1024(ArrayRadixOrCompareSorter::radixsort_min_len_)
+template <typename ArrowType>
+class TestArraySortIndicesRandomRadix : public TestBase {};
+
+using RadixSortableTypes =
+    ::testing::Types<UInt8Type, UInt16Type, UInt32Type, UInt64Type, Int8Type, Int16Type,
+                     Int32Type, Int64Type, Decimal128Type>;
+
+TYPED_TEST_SUITE(TestArraySortIndicesRandomRadix, RadixSortableTypes);
+
+TYPED_TEST(TestArraySortIndicesRandomRadix, SortRandomValuesRadix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  Random<TypeParam> rand(0x5487658);
+  int times = 3;
+  int length = 3000;
+  for (int test = 0; test < times; test++) {
+    for (auto null_probability : {0.0, 0.1, 1.0}) {
+      // Slice to exercise non-zero offsets
+      auto array = rand.Generate(length, null_probability)->Slice(7);
+      for (auto order : AllOrders()) {
+        for (auto null_placement : AllNullPlacements()) {
+          ArraySortOptions options(order, null_placement);
+          ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets,
+                               SortIndices(*array, options));
+          ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                    *checked_pointer_cast<UInt64Array>(offsets), order,
+                                    null_placement);
+        }
+      }
+    }
+  }
+}
+
+template <typename ArrowType>
+void CheckRadixSortReal(random::RandomArrayGenerator* generator) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  auto type = TypeTraits<ArrowType>::type_singleton();
+
+  // Signed zeros compare equal and must keep their relative order
+  ArrayVector chunks = {ArrayFromJSON(
+      type, "[-0.0, 0.0, null, -0.0, NaN, Infinity, -Infinity, 1.5, -1.5, 0.0, NaN]")};
+  for (int i = 0; i < 3; i++) {
+    chunks.push_back(generator->ArrayOf(type, 1000, /*null_probability=*/0.1));
+    chunks.push_back(chunks.front());
+  }
+  ASSERT_OK_AND_ASSIGN(auto array, Concatenate(chunks));
+  // Randomly generated values are all positive, negate some of them
+  ASSERT_OK_AND_ASSIGN(auto negated, CallFunction("negate", {array}));
+  ASSERT_OK_AND_ASSIGN(array, Concatenate({array, negated.make_array()}));
+
+  for (auto order : AllOrders()) {
+    for (auto null_placement : AllNullPlacements()) {
+      ArraySortOptions options(order, null_placement);
+      ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets, SortIndices(*array, options));
+      ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                *checked_pointer_cast<UInt64Array>(offsets), order,
+                                null_placement);
+    }
+  }
+}
+
+TEST(TestArraySortIndices, SortRandomValuesRadixReal) {
+  random::RandomArrayGenerator generator(0x5487659);
+  CheckRadixSortReal<FloatType>(&generator);
+  CheckRadixSortReal<DoubleType>(&generator);
+}
+
+TEST(TestArraySortIndices, SortRandomValuesRadixDecimal256) {
+  random::RandomArrayGenerator generator(0x548765a);
+  auto array = generator.ArrayOf(decimal256(40, 3), 3000, /*null_probability=*/0.1);
+  for (auto order : AllOrders()) {
+    for (auto null_placement : AllNullPlacements()) {
+      ArraySortOptions options(order, null_placement);
+      ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets, SortIndices(*array, options));
+      ValidateSorted<Decimal256Array>(*checked_pointer_cast<Decimal256Array>(array),
+                                      *checked_pointer_cast<UInt64Array>(offsets), order,
+                                      null_placement);
+    }
+  }
+}
+
 // Test basic cases for chunked array.
 class TestChunkedArraySortIndices : public ::testing::Test {};
 
@@ -1583,6 +1667,74 @@ TEST_F(TestTableSortIndices, HeterogenousChunking) {
   AssertSortIndices(table, options, "[3, 4, 2, 5, 1, 0, 6, 7]");
 }
 
+// Many fixed-width sort keys with duplicates, nulls and NaNs, checked against
+// successive stable sorts on each key from the last to the first
+TEST_F(TestTableSortIndices, FixedWidthKeysRandom) {
+  ::arrow::random::RandomArrayGenerator rng(0x5487660);
+  const int64_t length = 500;
+  auto make_column = [&](const std::shared_ptr<DataType>& type,
+                         double null_probability) -> std::shared_ptr<ChunkedArray> {
+    ArrayVector chunks;
+    for (int64_t chunk_length : {100, 0, 250, 150}) {
+      if (type->id() == Type::DOUBLE) {
+        chunks.push_back(rng.Float64(chunk_length, -2, 2, null_probability,
+                                     /*nan_probability=*/0.1));
+      } else if (type->id() == Type::INT32) {
+        chunks.push_back(rng.Int32(chunk_length, -3, 3, null_probability));
+      } else if (type->id() == Type::UINT8) {
+        chunks.push_back(rng.UInt8(chunk_length, 0, 2, null_probability));
+      } else if (type->id() == Type::BOOL) {
+        chunks.push_back(rng.Boolean(chunk_length, 0.5, null_probability));
+      } else {
+        chunks.push_back(rng.ArrayOf(type, chunk_length, null_probability));
+      }
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), type);
+  };
+  const FieldVector fields = {
+      field("a", uint8()),           field("b", int32()),  field("c", float64()),
+      field("d", boolean()),         field("e", int32()),  field("f", float64()),
+      field("g", decimal128(5, 2)),  field("h", uint8()),  field("i", boolean()),
+      field("j", decimal256(40, 3)), field("k", int64()),
+  };
+  ChunkedArrayVector columns;
+  for (size_t i = 0; i < fields.size(); ++i) {
+    columns.push_back(make_column(fields[i]->type(), i % 2 ? 0.2 : 0.0));
+  }
+  auto table = Table::Make(schema(fields), columns, length);
+
+  std::vector<SortKey> sort_keys;
+  for (size_t i = 0; i < fields.size(); ++i) {
+    sort_keys.emplace_back(fields[i]->name(),
+                           i % 3 ? SortOrder::Ascending : SortOrder::Descending);
+  }
+
+  for (auto null_placement : AllNullPlacements()) {
+    ARROW_SCOPED_TRACE("null_placement = ", null_placement);
+    SortOptions options(sort_keys, null_placement);
+    ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(table), options));
+
+    std::vector<uint64_t> row_numbers(length);
+    std::iota(row_numbers.begin(), row_numbers.end(), 0);
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<UInt64Type>(row_numbers, &expected);
+    for (auto it = sort_keys.rbegin(); it != sort_keys.rend(); ++it) {
+      auto column = table->GetColumnByName(*it->target.name());
+      ASSERT_OK_AND_ASSIGN(auto sorted, Take(Datum(column), Datum(expected)));
+      ASSERT_OK_AND_ASSIGN(auto indices,
+                           SortIndices(*sorted.chunked_array(),
+                                       ArraySortOptions(it->order, null_placement)));
+      ASSERT_OK_AND_ASSIGN(expected, Take(*expected, *indices));
+    }
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+
+    // The same holds for a record batch
+    ASSERT_OK_AND_ASSIGN(auto batch, table->CombineChunksToBatch());
+    ASSERT_OK_AND_ASSIGN(actual, SortIndices(Datum(batch), options));
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+  }
+}
+
 // Tests for temporal types
 template <typename ArrowType>
 class TestTableSortIndicesForTemporal : public TestTableSortIndices {
@@ -1614,6 +1766,44 @@ TYPED_TEST(TestTableSortIndicesForTemporal, NoNull) {
   }
 }
 
+// Large inputs are sorted and merged using multiple threads, check against
+// a single-threaded sort
+TEST(TestSortIndices, ParallelSort) {
+  ::arrow::random::RandomArrayGenerator rng(0x5487661);
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  const int64_t num_chunks = 13;
+  const int64_t chunk_length = 20000;
+  ArrayVector ints, doubles, strings;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    ints.push_back(rng.Int32(chunk_length, -1000, 1000, /*null_probability=*/0.1));
+    doubles.push_back(rng.Float64(chunk_length, -1, 1, /*null_probability=*/0.1,
+                                  /*nan_probability=*/0.1));
+    strings.push_back(rng.StringWithRepeats(chunk_length, /*unique=*/100,
+                                            /*min_length=*/1, /*max_length=*/5,
+                                            /*null_probability=*/0.1));
+  }
+  auto table = Table::Make(
+      schema({field("i", int32()), field("d", float64()), field("s", utf8())}),
+      {std::make_shared<ChunkedArray>(ints), std::make_shared<ChunkedArray>(doubles),
+       std::make_shared<ChunkedArray>(strings)});
+
+  for (auto null_placement : AllNullPlacements()) {
+    ARROW_SCOPED_TRACE("null_placement = ", null_placement);
+    for (const auto& sort_keys : std::vector<std::vector<SortKey>>{
+             {SortKey("d", SortOrder::Descending)},
+             {SortKey("i"), SortKey("d", SortOrder::Descending)},
+             {SortKey("s", SortOrder::Descending), SortKey("i"), SortKey("d")}}) {
+      SortOptions options(sort_keys, null_placement);
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           SortIndices(Datum(table), options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(table), options));
+      AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+    }
+  }
+}
+
 // For random table tests.
 using RandomParam = std::tuple<std::string, int, double>;
 
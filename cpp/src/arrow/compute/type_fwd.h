@@ -25,6 +25,7 @@ struct ValueDescr;
 namespace compute {
 
 class Function;
+class FunctionExecutor;
 class FunctionOptions;
 
 class CastOptions;
@@ -1171,27 +1171,51 @@ Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
                           scan_options->projection.Bind(Schema(std::move(fields))));
   }
 
-  // using a generator for speculative forward compatibility with async fragment discovery
-  ARROW_ASSIGN_OR_RAISE(auto fragments_it, dataset->GetFragments(scan_options->filter));
-  ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
-  auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
+  auto make_batch_gen = [dataset, require_sequenced_output](
+                            const std::shared_ptr<ScanOptions>& scan_options)
+      -> Result<AsyncGenerator<EnumeratedRecordBatch>> {
+    // using a generator for speculative forward compatibility with async fragment
+    // discovery
+    ARROW_ASSIGN_OR_RAISE(auto fragments_it, dataset->GetFragments(scan_options->filter));
+    ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
+    auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
+
+    ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
+                          FragmentsToBatches(std::move(fragment_gen), scan_options));
+
+    AsyncGenerator<EnumeratedRecordBatch> merged_batch_gen;
+    if (require_sequenced_output) {
+      ARROW_ASSIGN_OR_RAISE(merged_batch_gen, MakeSequencedMergedGenerator(
+                                                  std::move(batch_gen_gen),
+                                                  scan_options->fragment_readahead));
+    } else {
+      merged_batch_gen =
+          MakeMergedGenerator(std::move(batch_gen_gen), scan_options->fragment_readahead);
+    }
 
-  ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
-                        FragmentsToBatches(std::move(fragment_gen), scan_options));
+    return MakeReadaheadGenerator(std::move(merged_batch_gen),
+                                  scan_options->fragment_readahead);
+  };
 
-  AsyncGenerator<EnumeratedRecordBatch> merged_batch_gen;
-  if (require_sequenced_output) {
-    ARROW_ASSIGN_OR_RAISE(merged_batch_gen,
-                          MakeSequencedMergedGenerator(std::move(batch_gen_gen),
-                                                       scan_options->fragment_readahead));
+  AsyncGenerator<EnumeratedRecordBatch> batch_gen;
+  if (scan_node_options.dynamic_filter.is_valid()) {
+    // Defer fragment discovery until the dynamic filter is known so that it can be used
+    // to prune fragments (by partition expression) and row groups (by statistics)
+    auto batch_gen_fut = scan_node_options.dynamic_filter.Then(
+        [dataset, scan_options,
+         make_batch_gen](const compute::Expression& dynamic_filter)
+            -> Result<AsyncGenerator<EnumeratedRecordBatch>> {
+          auto pruning_options = std::make_shared<ScanOptions>(*scan_options);
+          ARROW_ASSIGN_OR_RAISE(
+              pruning_options->filter,
+              and_(scan_options->filter, dynamic_filter).Bind(*dataset->schema()));
+          return make_batch_gen(pruning_options);
+        });
+    batch_gen = MakeFromFuture(std::move(batch_gen_fut));
   } else {
-    merged_batch_gen =
-        MakeMergedGenerator(std::move(batch_gen_gen), scan_options->fragment_readahead);
+    ARROW_ASSIGN_OR_RAISE(batch_gen, make_batch_gen(scan_options));
   }
 
-  auto batch_gen = MakeReadaheadGenerator(std::move(merged_batch_gen),
-                                          scan_options->fragment_readahead);
-
   auto gen = MakeMappedGenerator(
       std::move(batch_gen),
       [scan_options](const EnumeratedRecordBatch& partial)
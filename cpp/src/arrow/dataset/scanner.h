@@ -431,7 +431,14 @@ class ARROW_DS_EXPORT ScanNodeOptions : public compute::ExecNodeOptions {
   std::shared_ptr<Dataset> dataset;
   std::shared_ptr<ScanOptions> scan_options;
   std::shared_ptr<util::AsyncToggle> backpressure_toggle;
+  /// If true, batches are yielded in fragment then batch order, so the ExecBatch::index
+  /// assigned to each batch follows that order. A sink with sequence_output set can then
+  /// restore it after parallel filtering and projection.
   bool require_sequenced_output;
+  /// If valid, fragments are not enumerated until this future completes. The predicate
+  /// it yields is combined with ScanOptions::filter to skip fragments and row groups
+  /// which cannot satisfy it. See compute::HashJoinNodeOptions::dynamic_filter.
+  Future<compute::Expression> dynamic_filter;
 };
 
 /// @}
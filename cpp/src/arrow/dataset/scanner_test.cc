@@ -1456,6 +1456,41 @@ TEST(ScanNode, DeferredFilterOnPhysicalColumn) {
   ASSERT_THAT(plan.Run(), Finishes(ResultWith(UnorderedElementsAreArray(expected))));
 }
 
+TEST(ScanNode, DynamicFilterPrunesFragments) {
+  TestPlan plan;
+
+  auto basic = MakeBasicDataset();
+
+  auto options = std::make_shared<ScanOptions>();
+  options->use_async = true;
+  // ensure all fields are materialized
+  options->projection = Materialize({"a", "b", "c"}, /*include_aug_fields=*/true);
+
+  ScanNodeOptions scan_options{basic.dataset, options};
+  scan_options.dynamic_filter = Future<compute::Expression>::Make();
+
+  ASSERT_OK(compute::Declaration::Sequence(
+                {
+                    {"scan", scan_options},
+                    {"sink", compute::SinkNodeOptions{&plan.sink_gen}},
+                })
+                .AddToPlan(plan.get()));
+
+  auto collected = plan.Run();
+  // no fragments are scanned until the dynamic filter is known
+  AssertNotFinished(collected);
+
+  scan_options.dynamic_filter.MarkFinished(
+      call("is_in", {field_ref("c")},
+           compute::SetLookupOptions{ArrayFromJSON(int32(), "[11, 47]")}));
+
+  // only the second fragment can satisfy the dynamic filter
+  auto expected = basic.batches;
+  expected.erase(expected.begin(), expected.begin() + 2);
+
+  ASSERT_THAT(collected, Finishes(ResultWith(UnorderedElementsAreArray(expected))));
+}
+
 TEST(ScanNode, DISABLED_ProjectionPushdown) {
   // ARROW-13263
   TestPlan plan;
@@ -471,6 +471,29 @@ class ScalarMemoTable : public MemoTable {
 
   void CopyValues(Scalar* out_data) const { CopyValues(0, out_data); }
 
+  // Insert the entries of `other_table` in their insertion order, storing
+  // into `out_indices` (if non-null) the index in this table of each of them.
+  Status MergeTable(const ScalarMemoTable& other_table,
+                    std::vector<int32_t>* out_indices = NULLPTR) {
+    std::vector<Scalar> values(other_table.size());
+    other_table.CopyValues(values.data());
+    if (out_indices != NULLPTR) {
+      out_indices->resize(values.size());
+    }
+    for (int32_t i = 0; i < other_table.size(); ++i) {
+      int32_t memo_index;
+      if (i == other_table.GetNull()) {
+        memo_index = GetOrInsertNull();
+      } else {
+        RETURN_NOT_OK(GetOrInsert(values[i], &memo_index));
+      }
+      if (out_indices != NULLPTR) {
+        (*out_indices)[i] = memo_index;
+      }
+    }
+    return Status::OK();
+  }
+
  protected:
   struct Payload {
     Scalar value;
@@ -580,6 +603,27 @@ class SmallScalarMemoTable : public MemoTable {
 
   const std::vector<Scalar>& values() const { return index_to_value_; }
 
+  // Insert the entries of `other_table` in their insertion order, storing
+  // into `out_indices` (if non-null) the index in this table of each of them.
+  Status MergeTable(const SmallScalarMemoTable& other_table,
+                    std::vector<int32_t>* out_indices = NULLPTR) {
+    if (out_indices != NULLPTR) {
+      out_indices->resize(other_table.size());
+    }
+    for (int32_t i = 0; i < other_table.size(); ++i) {
+      int32_t memo_index;
+      if (i == other_table.GetNull()) {
+        memo_index = GetOrInsertNull();
+      } else {
+        RETURN_NOT_OK(GetOrInsert(other_table.index_to_value_[i], &memo_index));
+      }
+      if (out_indices != NULLPTR) {
+        (*out_indices)[i] = memo_index;
+      }
+    }
+    return Status::OK();
+  }
+
  protected:
   static constexpr auto cardinality = SmallScalarTraits<Scalar>::cardinality;
   static_assert(cardinality <= 256, "cardinality too large for direct-addressed table");
@@ -803,6 +847,27 @@ class BinaryMemoTable : public MemoTable {
     }
   }
 
+  // Insert the entries of `other_table` in their insertion order, storing
+  // into `out_indices` (if non-null) the index in this table of each of them.
+  Status MergeTable(const BinaryMemoTable& other_table,
+                    std::vector<int32_t>* out_indices = NULLPTR) {
+    if (out_indices != NULLPTR) {
+      out_indices->resize(other_table.size());
+    }
+    for (int32_t i = 0; i < other_table.size(); ++i) {
+      int32_t memo_index;
+      if (i == other_table.GetNull()) {
+        memo_index = GetOrInsertNull();
+      } else {
+        RETURN_NOT_OK(GetOrInsert(other_table.binary_builder_.GetView(i), &memo_index));
+      }
+      if (out_indices != NULLPTR) {
+        (*out_indices)[i] = memo_index;
+      }
+    }
+    return Status::OK();
+  }
+
  protected:
   struct Payload {
     int32_t memo_index;
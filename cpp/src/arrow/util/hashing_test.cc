@@ -255,6 +255,27 @@ TEST(ScalarMemoTable, UInt16) {
   EXPECT_THAT(values, testing::ElementsAre(A, B, C, D, 0, E));
 }
 
+TEST(ScalarMemoTable, MergeTable) {
+  ScalarMemoTable<int64_t> table(default_memory_pool(), 0);
+  AssertGetOrInsert(table, 5, 0);
+  AssertGetOrInsert(table, 7, 1);
+
+  ScalarMemoTable<int64_t> other(default_memory_pool(), 0);
+  AssertGetOrInsert(other, 8, 0);
+  AssertGetOrInsertNull(other, 1);
+  AssertGetOrInsert(other, 7, 2);
+  AssertGetOrInsert(other, 9, 3);
+
+  std::vector<int32_t> indices;
+  ASSERT_OK(table.MergeTable(other, &indices));
+  EXPECT_THAT(indices, testing::ElementsAre(2, 3, 1, 4));
+  ASSERT_EQ(table.size(), 5);
+  AssertGetNull(table, 3);
+  std::vector<int64_t> values(table.size());
+  table.CopyValues(values.data());
+  EXPECT_THAT(values, testing::ElementsAre(5, 7, 8, 0, 9));
+}
+
 TEST(SmallScalarMemoTable, Int8) {
   const int8_t A = 1, B = 0, C = -1, D = -128, E = 127;
 
@@ -478,6 +499,28 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, MergeTable) {
+  BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), 0);
+  AssertGetOrInsertNull(table, 0);
+  AssertGetOrInsert(table, std::string("foo"), 1);
+
+  BinaryMemoTable<BinaryBuilder> other(default_memory_pool(), 0);
+  AssertGetOrInsert(other, std::string("bar"), 0);
+  AssertGetOrInsert(other, std::string("foo"), 1);
+  AssertGetOrInsertNull(other, 2);
+  AssertGetOrInsert(other, std::string(""), 3);
+
+  std::vector<int32_t> indices;
+  ASSERT_OK(table.MergeTable(other, &indices));
+  EXPECT_THAT(indices, testing::ElementsAre(2, 1, 0, 3));
+  ASSERT_EQ(table.size(), 4);
+  std::vector<std::string> actual;
+  table.VisitValues(0, [&](const util::string_view& v) {
+    actual.emplace_back(v.data(), v.length());
+  });
+  EXPECT_THAT(actual, testing::ElementsAre("", "foo", "bar", ""));
+}
+
 TEST(BinaryMemoTable, Empty) {
   BinaryMemoTable<BinaryBuilder> table(default_memory_pool());
   ASSERT_EQ(table.size(), 0);
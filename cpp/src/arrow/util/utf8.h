@@ -28,6 +28,7 @@
 #endif
 
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/simd.h"
 #include "arrow/util/string_view.h"
@@ -92,6 +93,43 @@ ARROW_EXPORT void CheckUTF8Initialized();
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
+/// \brief Return the number of leading ASCII bytes in `data`.
+///
+/// Scans 32 bytes at a time when SIMD is available, then 8 bytes at a time.
+static inline int64_t AsciiPrefixLength(const uint8_t* data, int64_t size) {
+  const uint8_t* p = data;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#ifdef ARROW_HAVE_NEON
+  using simd_batch = xsimd::batch<int8_t, xsimd::neon64>;
+#else
+  using simd_batch = xsimd::batch<int8_t, xsimd::sse4_2>;
+#endif
+  const simd_batch zero(static_cast<int8_t>(0));
+  while (size >= 32) {
+    simd_batch block = simd_batch::load_unaligned(reinterpret_cast<const int8_t*>(p));
+    block |= simd_batch::load_unaligned(reinterpret_cast<const int8_t*>(p + 16));
+    // Non-ASCII bytes have their upper bit set, i.e. are negative
+    if (xsimd::any(block < zero)) {
+      break;
+    }
+    p += 32;
+    size -= 32;
+  }
+#endif
+  while (size >= 8) {
+    if (SafeLoadAs<uint64_t>(p) & 0x8080808080808080ULL) {
+      break;
+    }
+    p += 8;
+    size -= 8;
+  }
+  while (size > 0 && *p < 0x80U) {
+    ++p;
+    --size;
+  }
+  return p - data;
+}
+
 static inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   static constexpr uint32_t high_bits_32 = 0x80808080UL;
@@ -108,9 +146,10 @@ static inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
     // performance nevertheless.
     uint64_t mask64 = SafeLoadAs<uint64_t>(data);
     if (ARROW_PREDICT_TRUE((mask64 & high_bits_64) == 0)) {
-      // 8 bytes of pure ASCII, move forward
-      size -= 8;
-      data += 8;
+      // 8 bytes of pure ASCII, move forward over the whole ASCII run
+      const int64_t ascii_length = 8 + AsciiPrefixLength(data + 8, size - 8);
+      size -= ascii_length;
+      data += ascii_length;
       continue;
     }
     // Non-ASCII run detected.
@@ -569,6 +608,13 @@ static inline bool UTF8AllOf(const uint8_t* first, const uint8_t* last, bool* re
 /// Count the number of codepoints in the given string (assuming it is valid UTF8).
 static inline int64_t UTF8Length(const uint8_t* first, const uint8_t* last) {
   int64_t length = 0;
+  // Count 8 bytes at a time, subtracting continuation bytes (0b10xxxxxx)
+  while (last - first >= 8) {
+    const uint64_t word = SafeLoadAs<uint64_t>(first);
+    const uint64_t continuations = word & ~(word << 1) & 0x8080808080808080ULL;
+    length += 8 - bit_util::PopCount(continuations);
+    first += 8;
+  }
   while (first != last) {
     length += ((*first++ & 0xc0) != 0x80);
   }
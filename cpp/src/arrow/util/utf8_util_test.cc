@@ -507,6 +507,29 @@ TEST(UTF8Length, Basics) {
   ASSERT_EQ(length("\xe3\x81\x81"), 1);
   // raised hands emoji (4 bytes)
   ASSERT_EQ(length("\xf0\x9f\x99\x8c"), 1);
+  // longer than a word, with multi-byte characters straddling word boundaries
+  ASSERT_EQ(length("abcdefg\xc3\x81"
+                   "bcdefghijklmn\xe3\x81\x81"
+                   "opq\xf0\x9f\x99\x8c"),
+            26);
+}
+
+TEST(AsciiPrefixLength, Basics) {
+  auto prefix_length = [](const std::string& s) {
+    return AsciiPrefixLength(reinterpret_cast<const uint8_t*>(s.data()), s.length());
+  };
+  ASSERT_EQ(prefix_length(""), 0);
+  ASSERT_EQ(prefix_length("\xc3\x81"), 0);
+  // Non-ASCII byte at every position of strings spanning several SIMD blocks
+  for (size_t length : {1, 7, 8, 9, 31, 32, 33, 100}) {
+    std::string s(length, 'x');
+    ASSERT_EQ(prefix_length(s), static_cast<int64_t>(length));
+    for (size_t i = 0; i < length; ++i) {
+      std::string t = s;
+      t[i] = '\x80';
+      ASSERT_EQ(prefix_length(t), static_cast<int64_t>(i));
+    }
+  }
 }
 
 }  // namespace util
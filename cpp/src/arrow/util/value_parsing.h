@@ -31,8 +31,10 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
 #include "arrow/vendored/strptime.h"
@@ -166,6 +168,56 @@ struct StringConverter<DoubleType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// SWAR ("SIMD within a register") helpers working on 8 characters at once.
+// The first character is in the least significant byte of the word.
+
+inline uint64_t LoadEightChars(const char* s) {
+  return bit_util::FromLittleEndian(util::SafeLoadAs<uint64_t>(
+      reinterpret_cast<const uint8_t*>(s)));
+}
+
+// Whether all 8 characters of `word` are decimal digits
+inline bool IsEightDecimalDigits(uint64_t word) {
+  // Each byte must be 0x3X with X <= 9, i.e. adding 6 must not carry into the
+  // high nibble
+  return (word & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL &&
+         ((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) ==
+             0x3030303030303030ULL;
+}
+
+// Convert 8 decimal digits to their value, combining adjacent digits pairwise
+inline uint32_t ParseEightDecimalDigits(uint64_t word) {
+  word -= 0x3030303030303030ULL;
+  word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FFULL;
+  word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFFULL;
+  word = (word * 10000 + (word >> 32)) & 0xFFFFFFFFULL;
+  return static_cast<uint32_t>(word);
+}
+
+// Parse `length` decimal digits, 8 at a time.  The caller must ensure the value
+// fits in a uint64_t, i.e. `length <= 19`.
+inline bool ParseDecimalDigitsSwar(const char* s, size_t length, uint64_t* out) {
+  uint64_t result = 0;
+  while (length >= 8) {
+    const uint64_t word = LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE(!IsEightDecimalDigits(word))) {
+      return false;
+    }
+    result = result * 100000000ULL + ParseEightDecimalDigits(word);
+    s += 8;
+    length -= 8;
+  }
+  for (; length > 0; --length) {
+    const uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  *out = result;
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -230,6 +282,15 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8 && length <= 9) {
+    // Cannot overflow
+    uint64_t result = 0;
+    if (ARROW_PREDICT_FALSE(!ParseDecimalDigitsSwar(s, length, &result))) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(result);
+    return true;
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -250,6 +311,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8 && length <= 19) {
+    // Cannot overflow
+    return ParseDecimalDigitsSwar(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -444,21 +509,23 @@ using ts_type = TimestampType::c_type;
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
-  uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
+  // Validate and convert "YYYY-MM-" in one go by replacing the dashes with zeros
+  constexpr uint64_t kDashes = 0xFF0000FF00000000ULL;
+  const uint64_t word = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((word & kDashes) != 0x2D00002D00000000ULL)) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  const uint64_t digits = (word & ~kDashes) | 0x3000003000000000ULL;
+  if (ARROW_PREDICT_FALSE(!IsEightDecimalDigits(digits))) {
     return false;
   }
+  const uint32_t year_month = ParseEightDecimalDigits(digits);  // YYYY0MM0
+  uint8_t day = 0;
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
+  const auto year = static_cast<uint16_t>(year_month / 10000);
+  const auto month = static_cast<uint8_t>(year_month / 10 % 100);
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -529,21 +596,20 @@ static inline bool ParseHHMM(const char* s, Duration* out) {
 
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
-  uint8_t hours = 0;
-  uint8_t minutes = 0;
-  uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
+  // Validate and convert "hh:mm:ss" in one go by replacing the colons with zeros
+  constexpr uint64_t kColons = 0x0000FF0000FF0000ULL;
+  const uint64_t word = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((word & kColons) != 0x00003A00003A0000ULL)) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  const uint64_t digits = (word & ~kColons) | 0x0000300000300000ULL;
+  if (ARROW_PREDICT_FALSE(!IsEightDecimalDigits(digits))) {
     return false;
   }
+  const uint32_t value = ParseEightDecimalDigits(digits);  // hh0mm0ss
+  const uint32_t hours = value / 1000000;
+  const uint32_t minutes = value / 1000 % 100;
+  const uint32_t seconds = value % 100;
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
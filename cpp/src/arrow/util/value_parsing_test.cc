@@ -396,6 +396,29 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("0x23512ak");
 }
 
+TEST(StringConversion, ToUInt64LongDigitRuns) {
+  // Values long enough to be parsed several digits at a time
+  const std::string digits = "1234567890123456789";
+  for (size_t length = 1; length <= digits.size(); ++length) {
+    const std::string s = digits.substr(0, length);
+    AssertConversion<UInt64Type>(s, std::stoull(s));
+    if (length <= 9) {
+      AssertConversion<UInt32Type>(s, static_cast<uint32_t>(std::stoul(s)));
+    }
+    // A non-digit at any position is rejected
+    for (size_t i = 0; i < length; ++i) {
+      for (const char c : {'/', ':', 'a', ' '}) {
+        std::string invalid = s;
+        invalid[i] = c;
+        AssertConversionFails<UInt64Type>(invalid);
+      }
+    }
+  }
+  AssertConversion<UInt64Type>("00000000000000000000001", 1);
+  AssertConversion<UInt32Type>("4294967295", 4294967295U);
+  AssertConversionFails<UInt32Type>("4294967296");
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
@@ -410,6 +433,16 @@ TEST(StringConversion, ToDate32) {
   AssertConversionFails<Date32Type>("1970-01");
   AssertConversionFails<Date32Type>("1970-01-01 00:00:00");
   AssertConversionFails<Date32Type>("1970/01/01");
+  AssertConversionFails<Date32Type>("197a-01-01");
+  AssertConversionFails<Date32Type>("1970-0:-01");
+  AssertConversionFails<Date32Type>("1970-01-0/");
+  AssertConversionFails<Date32Type>("1970 01-01");
+  AssertConversionFails<Date32Type>("1970-01 01");
+
+  // Invalid date value
+  AssertConversionFails<Date32Type>("1970-13-01");
+  AssertConversionFails<Date32Type>("1970-00-01");
+  AssertConversionFails<Date32Type>("1970-02-30");
 }
 
 TEST(StringConversion, ToDate64) {
@@ -431,6 +464,10 @@ void AssertInvalidTimes(const T& type) {
   AssertConversionFails(type, "00:00:00:");
   AssertConversionFails(type, "000000");
   AssertConversionFails(type, "000000.000");
+  AssertConversionFails(type, "00-00-00");
+  AssertConversionFails(type, "0a:00:00");
+  AssertConversionFails(type, "00:/0:00");
+  AssertConversionFails(type, "00:00:0:");
 
   // Invalid time value
   AssertConversionFails(type, "24:00:00");